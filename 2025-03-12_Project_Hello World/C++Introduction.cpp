@@ -287,6 +287,8 @@ void AwardExperience() {
 void PatrolArea() {
 	cout << "\nMust've been my imagination, back to patrol";
 }
+//for a whole crowd of enemies, the same if/else cascade is evaluated as a decision table instead (see dcsnDecisionTable.h)
+#include "dcsnDecisionTable.h"
 
 // Switch Statements
 int Day{ 6 };
@@ -419,28 +421,33 @@ bool IsEven(int Number) { // common use is to check if a number is even or odd
 	return Number % 2 == 0; // after being devided by 2: even will have a remainder of 0 (no leftovers), odd - 1
 } // in modular arithmetics "divisible by" used to refer to a scenario where modulo operator (%) returns 0, here - divisible by 2
 
+//divisors come from the number theory helpers (see nmthNumberTheory.h), which also have a sieve for checking lots of numbers at once
+#include "nmthNumberTheory.h"
+#include <algorithm>
 bool IsDivisibleBy(int x, int y) { // can I write the code that can tell which numbers an x number can be divisible by
 	cout << '\n';
-	y = x;
-	bool z{ true };
-	while (z != 0) {
-		for (y; y <= x; --y) {
-			if (x % y == 0) {
-				cout << y;
-			}
-			if (y == 1) {
-				cout << ".";
-				break; }
-			if (x % y == 0) {
-				cout << ", ";
+	if (x >= 1) { // prints every divisor of x, largest first: 6, 3, 2, 1.
+		std::uint32_t Divisors[nmthMaxDivisors32];
+		const int DivisorCount{ nmthDivisors(static_cast<std::uint32_t>(x), Divisors, nmthMaxDivisors32) };
+		//more than fit means none were written - sorting the buffer then would read past it
+		if (DivisorCount > nmthMaxDivisors32) {
+			std::cerr << x << " has more divisors (" << DivisorCount << ") than fit in the buffer\n";
+		} else {
+			std::sort(Divisors, Divisors + DivisorCount);
+			for (int i{ DivisorCount - 1 }; i >= 0; --i) {
+				cout << Divisors[i] << (i == 0 ? "." : ", ");
 			}
 		}
-		if (y == 1) break;
 	}
-	return 0;
+	// and answers the question in the name: is x divisible by y
+	//(x % 0 is undefined, and so is INT_MIN % -1 - the result overflows on the way, even though every int is divisible by -1)
+	return y == -1 || (y != 0 && x % y == 0);
 }
 
 int SmallerDividedByBigger{ 5 % 6 }; // when smaller number divided by larger number, reminder - smaller number itself, as it cannot be divided further
+//this "i % 3 == 0" pattern is often used to run work every Nth tick, for lots of entities that's a lot of divisions
+//fmodScheduler spreads such work evenly over the ticks instead, w/out dividing per entity (see fmodScheduler.h)
+#include "fmodScheduler.h"
 
 // Abstraction and Classes
 class Monster { // class is the main way to create custom user-defined type (abstract category of thing that are similar in some way, things within category - objects), class is like blueprint
@@ -509,28 +516,36 @@ private:
 	string mName; // (m) in mName stands for member (according no member naming convention, to prevent confusion, etc.)(can also have underscores: _name, Name_)
 };
 
+//names below are stored as interned symbols (32-bit id of a string that is stored only once), rather than a std::string copy per object
+//they're passed by value - copying a symbol is as cheap as copying an int
+#include "intrnSymbol.h"
+//messages from constructors, destructors and combat are logged in categories w their own levels, so eg. the Verbose lifecycle messages can be compiled out entirely (see clgLog.h)
+//here they're part of the lesson output, so they're Immediate - written in order w the std::cout lines around them
+//a category of per-tick diagnostics would be Deferred: formatted and written on a background thread (see alogLogger.h), so the game doesn't wait on std::cout
+#include "clgLog.h"
+LOG_CATEGORY(LogLifecycle, Verbose, Verbose, Immediate);
+LOG_CATEGORY(LogCombat, Log, Verbose, Immediate);
 class Foe {
 public:
-	Foe(string Name, int Health = 150) { // constructors can have optional parameters, so previous code can and should be simplified to this
+	Foe(intrnSymbol Name, int Health = 150) { // constructors can have optional parameters, so previous code can and should be simplified to this
 		mName = Name;
 		mHealth = Health;
-		cout << mName << " Ready for Battle!"
-			<< "\nHealth: " << mHealth;
+		LOG(LogLifecycle, Log, "{} Ready for Battle!\nHealth: {}", mName, mHealth);
 	}
 private:
-	string mName;
+	intrnSymbol mName;
 	int mHealth;
 };
 
 class DestructorFoe {
 public:
 	DestructorFoe() {
-		cout << "Monster Created\n";
+		LOG(LogLifecycle, Verbose, "Monster Created");
 	}
 	// destructor function (called automatically when an object is deleted
 	~DestructorFoe() { // syntax similar to constructor, but with (~) prefix
 		// ...
-		cout << "Monster Destroyed\n";
+		LOG(LogLifecycle, Verbose, "Monster Destroyed");
 	}
 	// seems like? when program is executed and exited (returns 0) all objects, apparently, get destroyed
 private:
@@ -557,14 +572,13 @@ public:
 	
 	// classes can define multiple constructors, allowing objects to be created with a variety of different argument lists
 	// once we define a custom constructor, the default is automatically deleted
-	DefaultMonster(string Name, int Health) { // constructor that takes a string argument, granting the ability for name to bes set at creation time, can have multiple parameters, separated by a (,)
+	DefaultMonster(intrnSymbol Name, int Health) { // constructor that takes a string argument, granting the ability for name to bes set at creation time, can have multiple parameters, separated by a (,)
 		mName = Name; // this is an example of where confusion can take place, w parameter of a constructor (function) and class members
 		mHealth = Health;
-		cout << mName << " Ready for Battle!"
-			<< "\nHealth: " << mHealth;
+		LOG(LogLifecycle, Log, "{} Ready for Battle!\nHealth: {}", mName, mHealth);
 	}
 private:
-	string mName;
+	intrnSymbol mName;
 	int mHealth;
 };
 
@@ -646,6 +660,8 @@ class Actor {
 public:
 	void Render() {};
 };
+//simulating the next frame and rendering the current one don't have to take turns - w two copies of the world they can overlap on two threads (see dbufPipeline.h)
+#include "dbufPipeline.h"
 //syntax for inheritance "class Child : public Parent { // public: code... };"
 class Character : public Actor { // by default inheritance is private, so here we set it to public (not overruling an access, if something was private in parent class - it will be private in child class)
 public:
@@ -698,6 +714,37 @@ class Healer : public Character {
 public:
 	void Heal(int Amount) { mHealth += Amount; } // since mHealth now not private but protected in base class, we can access it from derived class
 };
+//behavior for whole groups of Goblins, Dragons and Healers, authored by designers as behavior trees instead of hard-coded if/else (see bhvrBehaviorTree.h)
+#include "bhvrBehaviorTree.h"
+//in a real project these would be loaded from files, leaves are the C++ functions registered in a bhvrLibrary
+constexpr const char* bhvrGoblinTree{ R"(
+selector
+	sequence
+		condition IsDead
+		action DropLoot
+	sequence
+		condition IsLowHealth
+		action Enrage
+	action Attack
+)" };
+constexpr const char* bhvrDragonTree{ R"(
+selector
+	sequence
+		condition IsDead
+		action DropLoot
+	sequence
+		condition IsLowHealth
+		action Fly
+	action Attack
+)" };
+constexpr const char* bhvrHealerTree{ R"(
+selector
+	condition IsDead
+	sequence
+		condition IsLowHealth
+		action Heal
+	action Attack
+)" };
 // "public:", "protected:", "private:" - all three fundamental access specifiers: private - within same class they're defined, protected - same class + subclasses (child classes), public - from anywhere
 
 // Member Initializer List
@@ -708,18 +755,18 @@ public:
 class Monsters {
 public:
 	Monsters() {
-		cout << "\nDefault constructing Monsters";
+		LOG(LogLifecycle, Verbose, "Default constructing Monsters");
 	}
 	Monsters(int Health) : mHealth{Health}{
-		cout << "\nConstructing Monsters with an int";
+		LOG(LogLifecycle, Verbose, "Constructing Monsters with an int");
 	}
 	int GetHealth() { return mHealth; }
 public:
 	Monsters(int x, int y) {
-		std::cout << "\nTwo integers";
+		LOG(LogLifecycle, Verbose, "Two integers");
 	}
 	Monsters(int x, int y, int z) {
-		std::cout << "\nThree integers";
+		LOG(LogLifecycle, Verbose, "Three integers");
 	}
 protected:
 	int mHealth{ 100 };
@@ -867,7 +914,7 @@ void SomeFunction(const Characters& PlayerConstant) {
 // else - pass by constant reference (in real use cases: 2, 4 by far most common)
 class Weapon {
 public:
-	string Name;
+	intrnSymbol Name;
 };
 //reference within a user - defined type
 class ArmedCharacter {
@@ -983,12 +1030,12 @@ struct someOtherType {
 };
 class thisCharacter {
 private:
-	string mName;
+	intrnSymbol mName;
 	int mLevel{ 1 };
 public:
-	thisCharacter(string Name) : mName{ Name } {}
+	thisCharacter(intrnSymbol Name) : mName{ Name } {}
 	thisCharacter(int Level) : mLevel{ Level } {}
-	thisCharacter(string Name, int Level) :
+	thisCharacter(intrnSymbol Name, int Level) :
 		mName{ Name },
 		mLevel{ Level } {
 	}
@@ -1003,7 +1050,7 @@ public:
 			<< " has attacked me!";
 	}
 	//we might want to use "this" to return the object that the method was called on
-	thisCharacter& SetName(string Name) {
+	thisCharacter& SetName(intrnSymbol Name) {
 		mName = Name;
 		return *this;
 	}
@@ -1217,6 +1264,20 @@ void rtpBattle(rtpCharacter* A, rtpCharacter* B) {
 }
 //w everithing in place, now we've achieved run-time polymorphism (w/out changing any code in our Battle() function, its behavior now is - dynamic)
 //we can add depth by expanding Character base class and Battle() function whilst keeping the complexity under control (w this basic system in place)
+//lots of battles (or any other simulation stage) don't have to run one after another on the main thread, they can be spread over every core (see wstpThreadPool.h)
+#include "wstpThreadPool.h"
+//multi-step behaviors (patrol, spot, chase, attack) don't fit into a single rtpAct() call, instead of a hand-written state machine they can be coroutine scripts (see crtnScript.h)
+#include "crtnScript.h"
+crtnScript crtnGuardScript(rtpCharacter& Self, rtpCharacter& Target, const bool& SpottedTarget) {
+	cout << "\nPatrolling...";
+	co_await crtnUntil{ [&SpottedTarget] { return SpottedTarget; } }; // script sleeps here until the tick SpottedTarget is true
+	cout << "\nSpotted! Chasing...";
+	co_await crtnWait{ 2 };
+	for (int Attack{ 0 }; Attack < 3 && Target.rtpGetIsAlive(); ++Attack) {
+		Self.rtpAct(&Target);
+		co_await crtnNextTick{};
+	}
+}
 
 //Inclusion of the "virtual" keyword in class function changes calls to this function from being - statically bound to being - dynamically bound
 
@@ -1256,8 +1317,8 @@ void slcBattle(rtpCharacter Enemy) {
 //using dwnc prefix for clarity
 class dwncCharacter {
 public:
-	dwncCharacter(string Name) : mName{ Name } {}
-	string dwncGetName() { return mName; }
+	dwncCharacter(intrnSymbol Name) : mName{ Name } {}
+	intrnSymbol dwncGetName() { return mName; }
 
 public:
 	//to use dynamic_cast our type MUST be polymorphic (type w at least one "virtual" function)
@@ -1265,11 +1326,11 @@ public:
 	virtual ~dwncCharacter() = default;
 
 private:
-	string mName;
+	intrnSymbol mName;
 };
 class dwncGoblin : public dwncCharacter {
 public:
-	dwncGoblin(string Name) : dwncCharacter{ Name } {}
+	dwncGoblin(intrnSymbol Name) : dwncCharacter{ Name } {}
 	
 	void dwncEnrage() {
 		cout << "\nGetting Angry!";
@@ -1348,9 +1409,9 @@ void dwncHandle(dwncCharacter* Object) {
 //slightly more complex example (polymorphic combat system)
 class cdwncCharacter {
 public:
-	cdwncCharacter(string Name) : mName{ Name } {}
+	cdwncCharacter(intrnSymbol Name) : mName{ Name } {}
 	void cdwncTakeDamage(int Damage) {
-		cout << '\n' << mName << " Taking Damage";
+		LOG(LogCombat, Log, "{} Taking Damage", mName);
 		mHealth -= Damage;
 	}
 
@@ -1359,7 +1420,7 @@ public:
 	}
 
 protected:
-	string mName;
+	intrnSymbol mName;
 	int mHealth{ 150 };
 };
 //two Character objects are passed to Battle() as pointers, and they both Act() upon each other
@@ -1370,7 +1431,7 @@ void cdwncBattle(cdwncCharacter* A, cdwncCharacter* B) {
 //let's add more subclasses, below Vampire now has its own dedicated class, and also developed a weakness to wooden stakes (represented by vampire-specific Stake())
 class cdwncVampire : public cdwncCharacter {
 public:
-	cdwncVampire(string Name) : cdwncCharacter{ Name }{}
+	cdwncVampire(intrnSymbol Name) : cdwncCharacter{ Name }{}
 
 	void cdwncStake() {
 		cout << '\n' << mName << " Getting Staked";
@@ -1380,7 +1441,7 @@ public:
 //our player has become a VampireHunter which, for now, behaves in the same way as Character
 class cdwncVampireHunter : public cdwncCharacter {
 public:
-	cdwncVampireHunter(string Name) : cdwncCharacter{ Name } {}
+	cdwncVampireHunter(intrnSymbol Name) : cdwncCharacter{ Name } {}
 	
 	//we'd like to update our VampireHunter w the ability to Stake() vampire enemies, but we still need to fight non-vampires, too
 	//we can override Act() function and use dynamic_cast to determine whether or not we're fighting a Vampire
@@ -1418,6 +1479,7 @@ public:
 //in VS: from top menu bar: Project -> "ProjectName" Properties -> C/C++ -> Preprocessor -> Preprocessor Definitions
 //two configurations provided by default - "Debug", "Release"
 //we can create more configurations as needed, each can have its own set of preprocessor definitions (+ other settings), and we can quickly switch between configurations through user interface
+//(this project has a third one - "Benchmark", same as Release + BENCHMARK_BUILD, which swaps the lessons for measuring their performance claims, see before main())
 
 //"#ifdef" and "if" key difference:
 //preprocessor directives "#ifdef" analyzed at build time, whilst "if" - at run time
@@ -1455,9 +1517,22 @@ struct MyType {
 DEFINE_GREET
 DEFINE_ARG_GREET("Hi there", "a free function")
 
+//macros are also how profilers are usually hooked in - zones that measure a block of code in development builds
+//and completely disappear from the released ones (see prflProfiler.h)
+#include "prflProfiler.h"
+void prflUpdateEnemies(int EnemyCount) {
+	PROFILE_ZONE("UpdateEnemies");
+	PROFILE_COUNTER("Enemies", EnemyCount);
+	for (int i{ 0 }; i < EnemyCount; ++i) {
+		PROFILE_ZONE("UpdateEnemy");
+	}
+}
+
 // ! - unreal provides a lot of useful utilities in the form of macros, so you're likely using them quite heavily if you're writing C++ in that contex
 //for example, loging into Unreal console is done using two function-like macros, "UE_LOG" and "TEXT"
 //UE_LOG(LogTemp, Error, TEXT("Hello!"))
+//our own version of it is LOG (see clgLog.h), w categories declared like this:
+LOG_CATEGORY(LogTemp, Log, VeryVerbose, Immediate);
 
 // The #include Directive
 
@@ -1654,6 +1729,22 @@ private:
 //enmVampire enmEnemy;
 //enmFaction enmEnemyFaction { enmEnemy.enmGetFaction() };
 
+//comparing one faction at a time (like enmIsTroll) doesn't tell us who is hostile to whom
+//a constexpr relation table answers that, and a faction column w a bitset per faction lets us query many entities at once (see frltFactionRelations.h)
+#include "frltFactionRelations.h"
+constexpr int enmFactionCount{ 4 };
+//row - how that faction feels about the faction in each column (Goblin, Undead, Troll, Dragon)
+constexpr frltRelation enmRelations[enmFactionCount][enmFactionCount]{
+	{ frltRelation::Allied, frltRelation::Hostile, frltRelation::Neutral, frltRelation::Hostile },
+	{ frltRelation::Hostile, frltRelation::Allied, frltRelation::Hostile, frltRelation::Neutral },
+	{ frltRelation::Neutral, frltRelation::Hostile, frltRelation::Allied, frltRelation::Hostile },
+	{ frltRelation::Hostile, frltRelation::Neutral, frltRelation::Hostile, frltRelation::Allied }
+};
+constexpr frltRelationTable<enmFaction, enmFactionCount> enmRelationTable{ enmRelations };
+static_assert(enmRelationTable.frltIsHostile(enmFaction::Troll, enmFaction::Undead), "trolls hate the undead");
+//and to find eg. "all Trolls" w/out checking everyone, entities can be stored grouped by faction (see fprtStorage.h)
+#include "fprtStorage.h"
+
 // - advantages of enums
 //we could've used for variables some other type - for example, int or string
 // - if we use int: code becomes quite difficult to follow (have to remember what the numbers mean)
@@ -1708,6 +1799,7 @@ void usngHello() {
 //Faction MyFaction { Faction::Human };
 //w using enum statement:
 enum class usngFaction { Human, Elf, Undead };
+//(any such enum can be used as the faction of fprtStorage/frltFactionColumn, eg. fprtStorage<int, usngFaction, 3>)
 //using enum usngFaction;
 //usngFaction usngMyFaction{ Human };
 //note: this is relatively recent addition to the language, included as part of the C++20 spec., in projects w older compilers - will not be available
@@ -1729,6 +1821,14 @@ using usnginteger = std::int64_t;
 using usnginteger = std::int32_t;
 #endif
 //then we include this file in all our other files, and use "integer" alias like any other type
+//the same idea, per stat: each stat declares its range, and gets stored in the narrowest integer that fits it (see ntrwStat.h)
+//(arithmetic on them still happens as usnginteger)
+#include "ntrwStat.h"
+using usngHealth = ntrwStat<0, 10'000, usnginteger>;
+using usngLevel = ntrwStat<1, 100, usnginteger>;
+static_assert(sizeof(usngHealth) == 2 && sizeof(usngLevel) == 2, "both ranges fit in 16 bits");
+//for updating whole columns of such values at once (damage, healing, experience) - saturating arithmetic, see strtSaturate.h
+#include "strtSaturate.h"
 // - aliasing complex types
 //in C++ types can get pretty complex:
 
@@ -1812,25 +1912,30 @@ int dnmcaCalculateIndex() { return 2 + 1; }
 // - push_back():
 class dnmcaCharacter {
 public:
-	dnmcaCharacter(const std::string& Name)
+	dnmcaCharacter(intrnSymbol Name)
 		: Name(Name) {}
-	std::string Name;
+	intrnSymbol Name;
 };
 
 class dnmcamCharacter {
 public:
-	dnmcamCharacter(std::string Name) : mName{ Name } {}
+	dnmcamCharacter(intrnSymbol Name) : mName{ Name } {}
 
-	std::string dnmcamGetName() { return mName; }
+	intrnSymbol dnmcamGetName() { return mName; }
 	
-	void dnmcamSetName(std::string Name){
+	void dnmcamSetName(intrnSymbol Name){
 		mName = Name;
 	}
 
 private:
-	std::string mName;
+	intrnSymbol mName;
 };
 
+// - removing items w/out shifting
+//std::vector::erase() moves every element after the erased one, so frequently removing from a large array gets expensive
+//when the order of elements doesn't matter - a slot map erases in O(1) and hands out keys that stay valid (see sltmSlotMap.h)
+#include "sltmSlotMap.h"
+
 // - storing complex types in arrays
 //we can store pointers and references in arrays too:
 // - a collection of characters
@@ -1879,6 +1984,22 @@ void dnmcafSetCenter(dnmcafGrid* GridToLog, int Value) {
 	(*GridToLog)[1][1] = Value;
 }
 
+// - flat grids
+//each inner std::vector of a dnmcafGrid is a separate allocation, and every [Row][Col] has to go through the outer array first
+//grdGrid2D stores all cells in one block of memory (see grdGrid2D.h), and can be created from a dnmcafGrid
+#include "grdGrid2D.h"
+void dnmcafLogTopLeft(const grdGrid2D<int>& GridToLog) {
+	std::cout << "\nTop Left: " << GridToLog(0, 0);
+}
+//threat/influence maps over such grids are computed w stencil operators, rather than hand-written nested Row/Col loops (see stnclEngine.h)
+#include "stnclEngine.h"
+//dense grids can't represent huge maps that are mostly empty (1M x 1M ints would be ~4TB), for those we use a sparse chunked grid (see sprsGrid.h)
+#include "sprsGrid.h"
+//finding paths across a cost grid (A*, flow fields for shared goals, cached paths) - see pthfPathfinder.h
+#include "pthfPathfinder.h"
+//line of sight across the same kind of grid, for many enemies at once (see losLineOfSight.h)
+#include "losLineOfSight.h"
+
 // Memory Ownership and Smart Pointers
 //stack memory is straight-forward and efficient, automaticaly managing the lifecycle of our variables
 //limitations of stack memory include:
@@ -1914,7 +2035,7 @@ class smrtpCharacter {
 public:
 	std::string Name;
 	smrtpCharacter(std::string Name = "Frodo") : Name{ Name } {
-		std::cout << "\nCreating: " << Name;
+		LOG(LogLifecycle, Verbose, "Creating: {}", Name);
 	}
 	~smrtpCharacter() {
 		//std::cout << "\nDeleting: " << Name;
@@ -1968,6 +2089,10 @@ struct sbrsrcPlayer {
 	sbrsrcSword* Weapon{ nullptr };
 };
 //when we copy a Player object we should consider how subresources (such as the Weapon object) are handled as part of that process
+
+//note: every Sword above carries its own Name and Damage, even if thousands of them are the same "Iron Sword"
+//for large numbers of weapons the shared part can be moved into an archetype table (flyweight), see flywWeapon.h
+#include "flywWeapon.h"
 //there are ways we can control this copying process for custom types, thereby allowing us to implement the behaviors that are most appropriate for our use cases
 
 struct shrrSword{};
@@ -2038,6 +2163,24 @@ struct ccnstrPlayer {
 		std::cout << "\nCopying Player";
 	}
 
+	// - Move constructors
+	//a class that declares its own copy constructor gets no implicit move operations, so std::vector would copy it every time it grows
+	//moving steals the subresource from the original (here the pointer), leaving the original empty
+	//marking it "noexcept" is what lets std::vector use it during reallocation (otherwise it falls back to copying)
+	ccnstrPlayer(ccnstrPlayer&& Original) noexcept
+		: Weapon{ Original.Weapon } {
+		Original.Weapon = nullptr;
+	}
+	ccnstrPlayer& operator=(ccnstrPlayer&& Original) noexcept {
+		//same as w copy assignment - moving an object into itself must not empty it
+		if (&Original == this) {
+			return *this;
+		}
+		Weapon = Original.Weapon;
+		Original.Weapon = nullptr;
+		return *this;
+	}
+
 	ccnstrSword* Weapon{ nullptr };
 };
 //as we can see from the output, the copy constructor from Sword is not invoked, and both of our Player objects are left sharing the same weapon
@@ -2055,7 +2198,7 @@ struct ccnstrPlayer {
 struct dpcSword {
 	dpcSword() = default;
 	dpcSword(const dpcSword& Original) {
-		std::cout << "\nDeep copying Sword";
+		LOG(LogLifecycle, Verbose, "Deep copying Sword");
 	}
 };
 struct dpcPlayer {
@@ -2067,10 +2210,28 @@ struct dpcPlayer {
 		: Weapon{ std::make_unique<dpcSword>(
 			*Original.Weapon
 		) } {
-		std::cout << "\nDeep copying Player";
+		++Copies;
+		LOG(LogLifecycle, Verbose, "Deep copying Player");
+	}
+
+	//moving a Player just transfers ownership of its Sword (no deep copy, Sword copy constructor not invoked)
+	//(logged through the same LOG as the copies, so the lines come out in the order they happened)
+	dpcPlayer(dpcPlayer&& Original) noexcept
+		: Weapon{ std::move(Original.Weapon) } {
+		++Moves;
+		LOG(LogLifecycle, Verbose, "Moving Player");
+	}
+	dpcPlayer& operator=(dpcPlayer&& Original) noexcept {
+		Weapon = std::move(Original.Weapon);
+		++Moves;
+		LOG(LogLifecycle, Verbose, "Moving Player by Assignment");
+		return *this;
 	}
 
 	std::unique_ptr<dpcSword> Weapon;
+	//how many times Players got copied/moved so far, to check what std::vector does when it grows
+	static inline int Copies{ 0 };
+	static inline int Moves{ 0 };
 };
 //as we can see from the output, the entire Sword object is now being copied, rather than just a pointer to it
 //result: our Player objects are no longer sharing the same Sword - they each get their own
@@ -2132,6 +2293,15 @@ struct caoAPlayer {
 		return *this;
 	}
 
+	//moved-from APlayer is left w/out a Weapon, so it should only be reassigned or destroyed afterwards
+	caoAPlayer(caoAPlayer&& Original) noexcept
+		: Weapon{ std::move(Original.Weapon) } {
+	}
+	caoAPlayer& operator=(caoAPlayer&& Original) noexcept {
+		Weapon = std::move(Original.Weapon);
+		return *this;
+	}
+
 	std::unique_ptr<caoASword> Weapon;
 };
 
@@ -2208,19 +2378,64 @@ struct caoCPlayer {
 //Party class uses default copy functions, whilst Player has provided custom implementations
 struct rcrsvPlayer {
 	rcrsvPlayer() = default;
-	rcrsvPlayer(const rcrsvPlayer& Original) {
+	rcrsvPlayer(const rcrsvPlayer& Original)
+		: Health{ Original.Health },
+		Level{ Original.Level },
+		Experience{ Original.Experience } {
 		std::cout << "\nCopying Player by Constructor";
 	}
 	rcrsvPlayer& operator=(const rcrsvPlayer& Original) {
+		Health = Original.Health;
+		Level = Original.Level;
+		Experience = Original.Experience;
 		std::cout << "\nCopying Player by Assignment";
 		return *this;
 	}
+	rcrsvPlayer(rcrsvPlayer&& Original) noexcept
+		: Health{ Original.Health },
+		Level{ Original.Level },
+		Experience{ Original.Experience } {
+		std::cout << "\nMoving Player by Constructor";
+	}
+	rcrsvPlayer& operator=(rcrsvPlayer&& Original) noexcept {
+		Health = Original.Health;
+		Level = Original.Level;
+		Experience = Original.Experience;
+		std::cout << "\nMoving Player by Assignment";
+		return *this;
+	}
+
+	int Health{ 100 };
+	int Level{ 1 };
+	int Experience{ 0 };
 };
 struct rcrsvParty {
 	rcrsvPlayer rcrsvPlayerOne;
 	//Other Players
 	//...
 };
+
+// - Party snapshots
+//copying a Party goes through every Player's copy functions (logging included), which is too slow when we need thousands of copies per second
+//instead we can convert it to a flat snapshot once, and copy/restore that snapshot w a single memcpy
+#include "snpshParty.h"
+snpshParty rcrsvTakeSnapshot(const rcrsvParty& Party) {
+	snpshParty Snapshot{};
+	const rcrsvPlayer* Players[]{ &Party.rcrsvPlayerOne };
+	for (const rcrsvPlayer* Player : Players) {
+		Snapshot.Players[Snapshot.Count++] = { Player->Health, Player->Level, Player->Experience };
+	}
+	return Snapshot;
+}
+void rcrsvRestoreSnapshot(rcrsvParty& Party, const snpshParty& Snapshot) {
+	//members are written directly, so the Player copy functions are not invoked
+	rcrsvPlayer* Players[]{ &Party.rcrsvPlayerOne };
+	for (int i{ 0 }; i < Snapshot.Count; ++i) {
+		Players[i]->Health = Snapshot.Players[i].Health;
+		Players[i]->Level = Snapshot.Players[i].Level;
+		Players[i]->Experience = Snapshot.Players[i].Experience;
+	}
+}
 //in general: objects, that store subresources do not need to intervene to control how those subresources are copied
 //even if those subresources have non-standart requirements
 //we simply implement these requirements by defining copy constructors and operators on the type that needs them:
@@ -2255,8 +2470,1153 @@ struct shrptrPlayer {
 	std::shared_ptr<shrptrQuest> CurrentQuest;
 };
 
+// Measuring The Performance Claims
+//lots of lessons above say one way is faster than another - the Benchmark configuration (BENCHMARK_BUILD) measures them instead of running the lessons
+//every pair of cases does the same work both ways, results go to the console and to BenchmarkResults.json (to compare against later runs)
+//the modules added along the way are measured here too, against the tutorial code they replace (snapshots, flyweights, grids, pathfinding, logging, ...)
+//the original rtpAct(), dwncEnrage() and dnmcafLog...() print to cout, which would drown out what we measure - so those cases use quiet copies
+#ifdef BENCHMARK_BUILD
+#include "bnchBenchmark.h"
+#include <fstream>
+#include <thread>
+#include <unordered_map>
+
+class bnchCharacter {
+public:
+	virtual ~bnchCharacter() = default;
+	virtual int bnchAct(int Target) { return Target; }
+};
+class bnchGoblin : public bnchCharacter {
+public:
+	//same as rtpGoblin::rtpAct() - w "final" calls through a bnchGoblin* don't need the vtable, so they can be inlined
+	int bnchAct(int Target) final { return Target + 1; }
+};
+
+int bnchTopLeftByValue(dnmcafGrid GridToLog) {
+	bnchDoNotOptimize(GridToLog);
+	return GridToLog[0][0];
+}
+int bnchTopLeftByReference(const dnmcafGrid& GridToLog) {
+	bnchDoNotOptimize(GridToLog);
+	return GridToLog[0][0];
+}
+
+void bnchRegisterIdioms() {
+	// - prefix vs postfix ++ (postfix makes and returns a copy)
+	bnchRegister("thisVector3 prefix ++", [](std::uint64_t Iterations) {
+		thisVector3 Vector{ 1.0, 2.0, 3.0 };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) bnchDoNotOptimize(++Vector);
+	});
+	bnchRegister("thisVector3 postfix ++", [](std::uint64_t Iterations) {
+		thisVector3 Vector{ 1.0, 2.0, 3.0 };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) bnchDoNotOptimize(Vector++);
+	});
+
+	// - push_back vs emplace_back (push_back constructs a temporary, then moves it in)
+	//the vectors are cleared every 256 items, so capacity is kept and only the adding is measured
+	bnchRegister("push_back std::string", [](std::uint64_t Iterations) {
+		std::vector<std::string> Names;
+		Names.reserve(256);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			if (Names.size() == 256) Names.clear();
+			Names.push_back(std::string{ "Aragorn, son of Arathorn" });
+			bnchDoNotOptimize(Names.back());
+		}
+	});
+	bnchRegister("emplace_back std::string", [](std::uint64_t Iterations) {
+		std::vector<std::string> Names;
+		Names.reserve(256);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			if (Names.size() == 256) Names.clear();
+			Names.emplace_back("Aragorn, son of Arathorn");
+			bnchDoNotOptimize(Names.back());
+		}
+	});
+
+	// - growth vs reserve (one iteration - a new vector w 1000 ints)
+	bnchRegister("vector growth x1000", [](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			std::vector<int> Values;
+			for (int Value{ 0 }; Value < 1000; ++Value) Values.push_back(Value);
+			bnchDoNotOptimize(Values.data());
+		}
+	});
+	bnchRegister("vector reserve x1000", [](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			std::vector<int> Values;
+			Values.reserve(1000);
+			for (int Value{ 0 }; Value < 1000; ++Value) Values.push_back(Value);
+			bnchDoNotOptimize(Values.data());
+		}
+	});
+
+	// - passing a dnmcafGrid by value vs by reference (64x64, by value copies every row)
+	bnchRegister("dnmcafGrid by value", [](std::uint64_t Iterations) {
+		dnmcafGrid Grid(64, std::vector<int>(64, 1));
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) bnchDoNotOptimize(bnchTopLeftByValue(Grid));
+	});
+	bnchRegister("dnmcafGrid by reference", [](std::uint64_t Iterations) {
+		dnmcafGrid Grid(64, std::vector<int>(64, 1));
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) bnchDoNotOptimize(bnchTopLeftByReference(Grid));
+	});
+
+	// - virtual vs final calls
+	//bnchDoNotOptimize on the pointer hides what it points at, so the virtual call has to go through the vtable
+	bnchRegister("virtual Act", [](std::uint64_t Iterations) {
+		bnchGoblin Goblin;
+		bnchCharacter* Character{ &Goblin };
+		bnchDoNotOptimize(Character);
+		int Target{ 0 };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Target = Character->bnchAct(Target);
+			bnchDoNotOptimize(Target);
+		}
+	});
+	bnchRegister("final Act", [](std::uint64_t Iterations) {
+		bnchGoblin Goblin;
+		bnchGoblin* GoblinPtr{ &Goblin };
+		bnchDoNotOptimize(GoblinPtr);
+		int Target{ 0 };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Target = GoblinPtr->bnchAct(Target);
+			bnchDoNotOptimize(Target);
+		}
+	});
+
+	// - static_cast vs dynamic_cast downcasts (dynamic_cast checks the type at run time)
+	bnchRegister("static_cast downcast", [](std::uint64_t Iterations) {
+		dwncGoblin Goblin{ "Bonker" };
+		dwncCharacter* Enemy{ &Goblin };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchDoNotOptimize(Enemy);
+			bnchDoNotOptimize(static_cast<dwncGoblin*>(Enemy));
+		}
+	});
+	bnchRegister("dynamic_cast downcast", [](std::uint64_t Iterations) {
+		dwncGoblin Goblin{ "Bonker" };
+		dwncCharacter* Enemy{ &Goblin };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchDoNotOptimize(Enemy);
+			bnchDoNotOptimize(dynamic_cast<dwncGoblin*>(Enemy));
+		}
+	});
+}
+
+// - the modules' own performance goals (the requests that added them asked for these numbers)
+crtnScript bnchTickingScript() {
+	while (true) co_await crtnNextTick{};
+}
+//First staggers the scripts, so about 1 in Period wakes up every tick
+crtnScript bnchWaitingScript(std::uint32_t First, std::uint32_t Period) {
+	co_await crtnWait{ First };
+	while (true) co_await crtnWait{ Period };
+}
+
+//same numbers every run, so runs can be compared
+std::uint32_t bnchRandom(std::uint32_t& State) {
+	State = State * 1664525u + 1013904223u;
+	return State >> 8;
+}
+
+void bnchRegisterModules() {
+	// - coroutine scripts (crtnScript.h): memory per script, resumes per second w 100k scripts alive
+	//the schedulers are shared w the cases, so the scripts stay suspended between runs (bnchClear() destroys them)
+	constexpr int bnchScripts{ 100'000 };
+	const std::size_t FramesBefore{ crtnFrameBytes() };
+	auto Ticking{ std::make_shared<crtnScheduler>() };
+	for (int Script{ 0 }; Script < bnchScripts; ++Script) Ticking->crtnStart(bnchTickingScript());
+	const double TickingBytes{ static_cast<double>(crtnFrameBytes() - FramesBefore) / bnchScripts };
+	bnchRegister("crtnTick 100k scripts, all resumed", [Ticking, TickingBytes](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) Ticking->crtnTick();
+		bnchSetItemsPerIteration(bnchScripts);
+		bnchSetCounter("frame_bytes_per_script", TickingBytes);
+	});
+
+	const std::size_t WaitingBefore{ crtnFrameBytes() };
+	auto Waiting{ std::make_shared<crtnScheduler>() };
+	for (int Script{ 0 }; Script < bnchScripts; ++Script) Waiting->crtnStart(bnchWaitingScript(Script % 100 + 1, 100));
+	const double WaitingBytes{ static_cast<double>(crtnFrameBytes() - WaitingBefore) / bnchScripts };
+	bnchRegister("crtnTick 100k scripts, 1% resumed", [Waiting, WaitingBytes](std::uint64_t Iterations) {
+		const std::uint64_t ResumesBefore{ Waiting->crtnResumes() };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) Waiting->crtnTick();
+		bnchSetItemsPerIteration(static_cast<double>(Waiting->crtnResumes() - ResumesBefore) / static_cast<double>(Iterations));
+		bnchSetCounter("frame_bytes_per_script", WaitingBytes);
+	});
+
+	// - profiler zones (prflProfiler.h): cost of one zone, against the same loop w/out it
+	//frames are ended every 4096 zones like a game would, otherwise the ring fills up and zones are just dropped - so that cost is included
+	bnchRegister("empty scope", [](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) bnchDoNotOptimize(i);
+	});
+	bnchRegister("PROFILE_ZONE", [](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			{
+				PROFILE_ZONE("bnchZone");
+				bnchDoNotOptimize(i);
+			}
+			if ((i & 4095) == 4095) PROFILE_FRAME();
+		}
+	});
+
+	// - saturating kernels (strtSaturate.h): damage to a column of 4096 healths, clamped at 0
+	constexpr int bnchHealths{ 4096 };
+	auto ScalarHealth{ std::make_shared<std::vector<std::int16_t>>(bnchHealths) };
+	auto KernelHealth{ std::make_shared<std::vector<std::int16_t>>(bnchHealths) };
+	std::uint32_t HealthSeed{ 7 };
+	for (int Index{ 0 }; Index < bnchHealths; ++Index) {
+		(*ScalarHealth)[Index] = (*KernelHealth)[Index] = static_cast<std::int16_t>(bnchRandom(HealthSeed) % 10'000);
+	}
+	bnchRegister("damage x4096, if (Health < 0)", [ScalarHealth](std::uint64_t Iterations) {
+		std::int16_t* Health{ ScalarHealth->data() };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (int Index{ 0 }; Index < bnchHealths; ++Index) {
+				int Value{ Health[Index] - 7 };
+				if (Value < 0) Value = 0;
+				Health[Index] = static_cast<std::int16_t>(Value);
+			}
+			bnchDoNotOptimize(Health);
+		}
+		bnchSetItemsPerIteration(bnchHealths);
+	});
+	bnchRegister("damage x4096, strtSubClamp", [KernelHealth](std::uint64_t Iterations) {
+		std::int16_t* Health{ KernelHealth->data() };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			strtSubClamp(Health, bnchHealths, 7, 0, 10'000);
+			bnchDoNotOptimize(Health);
+		}
+		bnchSetItemsPerIteration(bnchHealths);
+	});
+
+	// - line of sight (losLineOfSight.h): 4096 random rays over a 256x256 map, one at a time vs batched
+	constexpr int bnchRays{ 4096 };
+	auto Map{ std::make_shared<grdGrid2D<int>>(256, 256, 1) };
+	auto Rays{ std::make_shared<std::vector<losPair>>(bnchRays) };
+	std::uint32_t MapSeed{ 12345 };
+	for (int Row{ 0 }; Row < 256; ++Row) {
+		for (int Col{ 0 }; Col < 256; ++Col) {
+			if (bnchRandom(MapSeed) % 20 == 0) (*Map)(Row, Col) = 0;
+		}
+	}
+	for (losPair& Ray : *Rays) {
+		Ray.From = { static_cast<int>(bnchRandom(MapSeed) % 256), static_cast<int>(bnchRandom(MapSeed) % 256) };
+		Ray.To = { static_cast<int>(bnchRandom(MapSeed) % 256), static_cast<int>(bnchRandom(MapSeed) % 256) };
+	}
+	bnchRegister("losCanSee x4096, one ray", [Map, Rays](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			int Visible{ 0 };
+			for (const losPair& Ray : *Rays) Visible += losCanSee(*Map, Ray.From, Ray.To);
+			bnchDoNotOptimize(Visible);
+		}
+		bnchSetItemsPerIteration(bnchRays);
+	});
+	bnchRegister("losCanSee x4096, batch", [Map, Rays](std::uint64_t Iterations) {
+		std::unique_ptr<bool[]> Visible{ new bool[bnchRays] };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			losCanSee(*Map, Rays->data(), bnchRays, Visible.get());
+			bnchDoNotOptimize(Visible);
+		}
+		bnchSetItemsPerIteration(bnchRays);
+	});
+
+	// - thread pool (wstpThreadPool.h): the same passes on 1, 2, 4, ... up to every hardware thread
+	constexpr int bnchUnits{ 1'000'000 };
+	constexpr stnclKernel3 bnchBlur{ { { 1, 2, 1 }, { 2, 4, 2 }, { 1, 2, 1 } }, 4 };
+	auto Units{ std::make_shared<std::vector<int>>(bnchUnits, 100) };
+	auto Influence{ std::make_shared<grdGrid2D<int>>(1024, 1024, 0) };
+	auto Blurred{ std::make_shared<grdGrid2D<int>>(1024, 1024, 0) };
+	std::uint32_t InfluenceSeed{ 99 };
+	for (int Source{ 0 }; Source < 256; ++Source) {
+		(*Influence)(static_cast<int>(bnchRandom(InfluenceSeed) % 1024), static_cast<int>(bnchRandom(InfluenceSeed) % 1024)) = 1 << 16;
+	}
+	const int HardwareThreads{ static_cast<int>(std::max(1u, std::thread::hardware_concurrency())) };
+	for (int Threads{ 1 }; ; Threads = std::min(Threads * 2, HardwareThreads)) {
+		auto Pool{ std::make_shared<wstpPool>(Threads - 1) };
+		const std::string OnThreads{ ", " + std::to_string(Threads) + (Threads == 1 ? " thread" : " threads") };
+		bnchRegister("wstpParallelFor 1M units" + OnThreads, [Pool, Units](std::uint64_t Iterations) {
+			int* Health{ Units->data() };
+			for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+				wstpParallelFor(*Pool, 0, bnchUnits, [Health](int Unit) {
+					Health[Unit] = Health[Unit] > 10 ? Health[Unit] - Unit % 11 : 100;
+				});
+				bnchDoNotOptimize(Health);
+			}
+			bnchSetItemsPerIteration(bnchUnits);
+		});
+		bnchRegister("wstpParallelFor 1024x1024 blur rows" + OnThreads, [Pool, Influence, Blurred, bnchBlur](std::uint64_t Iterations) {
+			for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+				wstpParallelFor(*Pool, 0, Influence->grdRows(), [&](int Row) {
+					thread_local std::vector<int> Accumulator;
+					Accumulator.assign(Influence->grdCols(), 0);
+					stnclAccumulateRow(*Influence, Row, bnchBlur, Accumulator.data());
+					int* Out{ Blurred->grdRowData(Row) };
+					for (int Col{ 0 }; Col < Influence->grdCols(); ++Col) Out[Col] = Accumulator[Col] >> bnchBlur.Shift;
+				});
+				bnchDoNotOptimize(Blurred->grdRowData(0));
+			}
+			bnchSetItemsPerIteration(1024.0 * 1024.0);
+		});
+		if (Threads == HardwareThreads) break;
+	}
+}
+
+// - the backlog's replacements for tutorial types and loops, each against the code it replaces
+//bnchRunBenchmarks() sends std::cout and the logger to bnchNullStream while these run, so cases that print (rcrsvPlayer, dpcPlayer's LOG)
+//measure formatting the text, not the console
+
+//swallows everything written to it
+class bnchNullBuffer : public std::streambuf {
+protected:
+	int_type overflow(int_type Character) override { return traits_type::not_eof(Character); }
+	std::streamsize xsputn(const char*, std::streamsize Count) override { return Count; }
+};
+bnchNullBuffer bnchNullSink;
+std::ostream bnchNullStream{ &bnchNullSink };
+
+//same as dpcPlayer, but w/out noexcept on the move constructor - std::vector can't move those when it grows
+//(a throw halfway through would lose Players), so it deep copies them instead
+struct bnchThrowingMovePlayer : dpcPlayer {
+	bnchThrowingMovePlayer() = default;
+	bnchThrowingMovePlayer(const bnchThrowingMovePlayer&) = default;
+	bnchThrowingMovePlayer(bnchThrowingMovePlayer&& Original) : dpcPlayer{ std::move(Original) } {}
+};
+
+//how names were stored before intrnSymbol - taken by value, then copied again into the member
+struct bnchStringNamed {
+	bnchStringNamed(std::string Name) : mName{ Name } {}
+	std::string mName;
+};
+struct bnchSymbolNamed {
+	bnchSymbolNamed(intrnSymbol Name) : mName{ Name } {}
+	intrnSymbol mName;
+};
+
+//roster entry, found by Id (other systems hold on to the Id, not to the position)
+struct bnchMember {
+	std::uint32_t Id;
+	int Health;
+};
+
+//Cell(Row, Col) - the same 3x3 sum for every layout
+template <typename Callable>
+long long bnchSumNeighbourhoods(int Size, Callable Cell) {
+	long long Total{ 0 };
+	for (int Row{ 1 }; Row < Size - 1; ++Row) {
+		for (int Col{ 1 }; Col < Size - 1; ++Col) {
+			for (int dy{ -1 }; dy <= 1; ++dy) {
+				for (int dx{ -1 }; dx <= 1; ++dx) Total += Cell(Row + dy, Col + dx);
+			}
+		}
+	}
+	return Total;
+}
+template <typename Callable>
+long long bnchSumColumns(int Size, Callable Cell) {
+	long long Total{ 0 };
+	for (int Col{ 0 }; Col < Size; ++Col) {
+		for (int Row{ 0 }; Row < Size; ++Row) Total += Cell(Row, Col);
+	}
+	return Total;
+}
+
+void bnchRegisterData() {
+	// - party snapshots (snpshParty.h): rcrsvParty's member-wise copy (logged) vs converting to a snapshot and back, vs copying snapshots, per player
+	bnchRegister("rcrsvParty copy", [](std::uint64_t Iterations) {
+		rcrsvParty Party;
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			rcrsvParty Copy{ Party };
+			bnchDoNotOptimize(Copy);
+		}
+		bnchSetItemsPerIteration(1);
+	});
+	bnchRegister("rcrsvParty to snapshot and back", [](std::uint64_t Iterations) {
+		rcrsvParty Party;
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			const snpshParty Snapshot{ rcrsvTakeSnapshot(Party) };
+			bnchDoNotOptimize(Snapshot);
+			rcrsvRestoreSnapshot(Party, Snapshot);
+			bnchDoNotOptimize(Party);
+		}
+		bnchSetItemsPerIteration(1);
+	});
+	bnchRegister("snpshParty push + restore, 8 players", [](std::uint64_t Iterations) {
+		snpshParty Party{};
+		Party.Count = snpshMaxPlayers;
+		snpshHistory<64> History;
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			History.snpshPush(Party);
+			snpshCopy(Party, History.snpshGet(0));
+			bnchDoNotOptimize(Party);
+		}
+		bnchSetItemsPerIteration(snpshMaxPlayers);
+	});
+
+	// - vector growth: 256 Players added one by one, dpcPlayer (noexcept move) vs the same Player whose move can throw
+	//both log every copy/move at Verbose, like the lesson does
+	bnchRegister("vector<dpcPlayer> growth x256, noexcept move", [](std::uint64_t Iterations) {
+		const int CopiesBefore{ dpcPlayer::Copies };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			std::vector<dpcPlayer> Party;
+			for (int Player{ 0 }; Player < 256; ++Player) Party.emplace_back();
+			bnchDoNotOptimize(Party.data());
+		}
+		bnchSetItemsPerIteration(256);
+		bnchSetCounter("copies_per_iteration", static_cast<double>(dpcPlayer::Copies - CopiesBefore) / static_cast<double>(Iterations));
+	});
+	bnchRegister("vector<dpcPlayer> growth x256, throwing move", [](std::uint64_t Iterations) {
+		const int CopiesBefore{ dpcPlayer::Copies };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			std::vector<bnchThrowingMovePlayer> Party;
+			for (int Player{ 0 }; Player < 256; ++Player) Party.emplace_back();
+			bnchDoNotOptimize(Party.data());
+		}
+		bnchSetItemsPerIteration(256);
+		bnchSetCounter("copies_per_iteration", static_cast<double>(dpcPlayer::Copies - CopiesBefore) / static_cast<double>(Iterations));
+	});
+
+	// - flyweight swords (flywWeapon.h): 1M equipped "Iron Sword"s, one durabillity decay pass over all of them
+	constexpr int bnchSwords{ 1'000'000 };
+	flywArchetypeTable Archetypes;
+	const flywArchetypeId IronSword{ Archetypes.flywRegister({ "Iron Sword", 41, 1.0f }) };
+	auto FullSwords{ std::make_shared<std::vector<sbrsrcSword>>(bnchSwords) };
+	auto LightSwords{ std::make_shared<std::vector<flywSword>>(bnchSwords, flywCreate(Archetypes, IronSword)) };
+	//"Iron Sword" fits in std::string's own buffer, so sbrsrcSword doesn't allocate on top of its size (longer names would)
+	bnchRegister("decay x1M, sbrsrcSword", [FullSwords](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (sbrsrcSword& Sword : *FullSwords) {
+				const float Decayed{ Sword.Durabillity - 0.0001f };
+				Sword.Durabillity = Decayed < 0.0f ? 0.0f : Decayed;
+			}
+			bnchDoNotOptimize(FullSwords->data());
+		}
+		bnchSetItemsPerIteration(bnchSwords);
+		bnchSetCounter("bytes_per_sword", sizeof(sbrsrcSword));
+	});
+	bnchRegister("decay x1M, flywSword", [LightSwords](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			flywDecayDurabillity(*LightSwords, 0.0001f);
+			bnchDoNotOptimize(LightSwords->data());
+		}
+		bnchSetItemsPerIteration(bnchSwords);
+		bnchSetCounter("bytes_per_sword", sizeof(flywSword));
+	});
+
+	// - interned names (intrnSymbol.h): spawning 1024 named characters, and comparing every name against one of them
+	constexpr int bnchNames{ 1024 };
+	auto NameTexts{ std::make_shared<std::vector<std::string>>() };
+	for (int Name{ 0 }; Name < bnchNames; ++Name) NameTexts->push_back("Bonker the Unbreakable, Goblin #" + std::to_string(Name));
+	const std::string& LongestName{ NameTexts->back() };
+	const double StringBytes{ static_cast<double>(sizeof(std::string) + std::string{ LongestName }.capacity() + 1) };
+	bnchRegister("spawn x1024, std::string names", [NameTexts, StringBytes](std::uint64_t Iterations) {
+		std::vector<bnchStringNamed> Spawned;
+		Spawned.reserve(bnchNames);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Spawned.clear();
+			for (const std::string& Name : *NameTexts) Spawned.emplace_back(Name);
+			bnchDoNotOptimize(Spawned.data());
+		}
+		bnchSetItemsPerIteration(bnchNames);
+		bnchSetCounter("bytes_per_name", StringBytes);
+	});
+	bnchRegister("spawn x1024, intrnSymbol names", [NameTexts](std::uint64_t Iterations) {
+		std::vector<bnchSymbolNamed> Spawned;
+		Spawned.reserve(bnchNames);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Spawned.clear();
+			for (const std::string& Name : *NameTexts) Spawned.emplace_back(Name);
+			bnchDoNotOptimize(Spawned.data());
+		}
+		bnchSetItemsPerIteration(bnchNames);
+		//the text itself is stored once for the whole program, not per character
+		bnchSetCounter("bytes_per_name", sizeof(intrnSymbol));
+	});
+	bnchRegister("name == x1024, std::string", [NameTexts](std::uint64_t Iterations) {
+		const std::vector<std::string> Names{ *NameTexts };
+		const std::string Target{ Names[bnchNames / 2] };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			int Matches{ 0 };
+			for (const std::string& Name : Names) Matches += Name == Target;
+			bnchDoNotOptimize(Matches);
+		}
+		bnchSetItemsPerIteration(bnchNames);
+	});
+	bnchRegister("name == x1024, intrnSymbol", [NameTexts](std::uint64_t Iterations) {
+		const std::vector<intrnSymbol> Names(NameTexts->begin(), NameTexts->end());
+		const intrnSymbol Target{ Names[bnchNames / 2] };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			int Matches{ 0 };
+			for (intrnSymbol Name : Names) Matches += Name == Target;
+			bnchDoNotOptimize(Matches);
+		}
+		bnchSetItemsPerIteration(bnchNames);
+	});
+
+	// - roster churn (sltmSlotMap.h): 1024 characters, every iteration one leaves, one joins and everyone's health is summed
+	constexpr int bnchRoster{ 1024 };
+	bnchRegister("roster churn x1024, std::vector::erase", [](std::uint64_t Iterations) {
+		std::vector<bnchMember> Roster;
+		std::vector<std::uint32_t> Handles;
+		for (std::uint32_t Id{ 0 }; Id < bnchRoster; ++Id) {
+			Roster.push_back({ Id, 100 });
+			Handles.push_back(Id);
+		}
+		std::uint32_t NextId{ bnchRoster };
+		std::uint32_t Seed{ 3 };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			std::uint32_t& Leaving{ Handles[bnchRandom(Seed) % bnchRoster] };
+			Roster.erase(std::find_if(Roster.begin(), Roster.end(), [Leaving](const bnchMember& Member) { return Member.Id == Leaving; }));
+			Roster.push_back({ NextId, 100 });
+			Leaving = NextId++;
+			int Total{ 0 };
+			for (const bnchMember& Member : Roster) Total += Member.Health;
+			bnchDoNotOptimize(Total);
+		}
+	});
+	bnchRegister("roster churn x1024, sltmSlotMap", [](std::uint64_t Iterations) {
+		sltmSlotMap<bnchMember> Roster;
+		std::vector<sltmKey> Handles;
+		for (std::uint32_t Id{ 0 }; Id < bnchRoster; ++Id) Handles.push_back(Roster.sltmInsert({ Id, 100 }));
+		std::uint32_t NextId{ bnchRoster };
+		std::uint32_t Seed{ 3 };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			sltmKey& Leaving{ Handles[bnchRandom(Seed) % bnchRoster] };
+			Roster.sltmErase(Leaving);
+			Leaving = Roster.sltmInsert({ NextId++, 100 });
+			int Total{ 0 };
+			for (const bnchMember& Member : Roster) Total += Member.Health;
+			bnchDoNotOptimize(Total);
+		}
+	});
+
+	// - narrow stats (ntrwStat.h): damage then healing over 1M healths, stored as int vs as usngHealth (16 bits)
+	constexpr int bnchStats{ 1'000'000 };
+	auto WideHealth{ std::make_shared<std::vector<int>>(bnchStats) };
+	auto NarrowHealth{ std::make_shared<std::vector<usngHealth>>(bnchStats) };
+	std::uint32_t StatSeed{ 11 };
+	for (int Index{ 0 }; Index < bnchStats; ++Index) {
+		(*WideHealth)[Index] = static_cast<int>(bnchRandom(StatSeed) % 10'001);
+		(*NarrowHealth)[Index] = usngHealth::ntrwClamped((*WideHealth)[Index]);
+	}
+	bnchRegister("health pass x1M, int", [WideHealth](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			const int Amount{ i & 1 ? -7 : 7 };
+			for (int& Health : *WideHealth) {
+				const int Value{ Health - Amount };
+				Health = Value < 0 ? 0 : Value > 10'000 ? 10'000 : Value;
+			}
+			bnchDoNotOptimize(WideHealth->data());
+		}
+		bnchSetItemsPerIteration(bnchStats);
+		bnchSetCounter("bytes_per_stat", sizeof(int));
+	});
+	bnchRegister("health pass x1M, usngHealth", [NarrowHealth](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			const int Amount{ i & 1 ? -7 : 7 };
+			for (usngHealth& Health : *NarrowHealth) Health -= Amount;
+			bnchDoNotOptimize(NarrowHealth->data());
+		}
+		bnchSetItemsPerIteration(bnchStats);
+		bnchSetCounter("bytes_per_stat", sizeof(usngHealth));
+	});
+}
+
+void bnchRegisterWorld() {
+	// - flat grids (grdGrid2D.h): every 3x3 neighbourhood, and every column, of a 1024x1024 grid
+	constexpr int bnchGridSize{ 1024 };
+	auto Nested{ std::make_shared<dnmcafGrid>(bnchGridSize, std::vector<int>(bnchGridSize)) };
+	std::uint32_t GridSeed{ 5 };
+	for (std::vector<int>& Row : *Nested) {
+		for (int& Cell : Row) Cell = static_cast<int>(bnchRandom(GridSeed) % 100);
+	}
+	auto RowMajor{ std::make_shared<grdGrid2D<int>>(*Nested) };
+	auto ZOrder{ std::make_shared<grdGrid2D<int, grdZOrder>>(*Nested) };
+	bnchRegister("3x3 sums 1024x1024, dnmcafGrid", [Nested](std::uint64_t Iterations) {
+		const dnmcafGrid& Grid{ *Nested };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchDoNotOptimize(bnchSumNeighbourhoods(bnchGridSize, [&Grid](int Row, int Col) { return Grid[Row][Col]; }));
+		}
+		bnchSetItemsPerIteration((bnchGridSize - 2.0) * (bnchGridSize - 2.0));
+	});
+	bnchRegister("3x3 sums 1024x1024, grdGrid2D row-major", [RowMajor](std::uint64_t Iterations) {
+		const grdGrid2D<int>& Grid{ *RowMajor };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchDoNotOptimize(bnchSumNeighbourhoods(bnchGridSize, [&Grid](int Row, int Col) { return Grid(Row, Col); }));
+		}
+		bnchSetItemsPerIteration((bnchGridSize - 2.0) * (bnchGridSize - 2.0));
+	});
+	bnchRegister("3x3 sums 1024x1024, grdGrid2D Z-order", [ZOrder](std::uint64_t Iterations) {
+		const grdGrid2D<int, grdZOrder>& Grid{ *ZOrder };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchDoNotOptimize(bnchSumNeighbourhoods(bnchGridSize, [&Grid](int Row, int Col) { return Grid(Row, Col); }));
+		}
+		bnchSetItemsPerIteration((bnchGridSize - 2.0) * (bnchGridSize - 2.0));
+	});
+	bnchRegister("column walk 1024x1024, dnmcafGrid", [Nested](std::uint64_t Iterations) {
+		const dnmcafGrid& Grid{ *Nested };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchDoNotOptimize(bnchSumColumns(bnchGridSize, [&Grid](int Row, int Col) { return Grid[Row][Col]; }));
+		}
+		bnchSetItemsPerIteration(bnchGridSize * bnchGridSize);
+	});
+	bnchRegister("column walk 1024x1024, grdGrid2D row-major", [RowMajor](std::uint64_t Iterations) {
+		const grdGrid2D<int>& Grid{ *RowMajor };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchDoNotOptimize(bnchSumColumns(bnchGridSize, [&Grid](int Row, int Col) { return Grid(Row, Col); }));
+		}
+		bnchSetItemsPerIteration(bnchGridSize * bnchGridSize);
+	});
+	bnchRegister("column walk 1024x1024, grdGrid2D Z-order", [ZOrder](std::uint64_t Iterations) {
+		const grdGrid2D<int, grdZOrder>& Grid{ *ZOrder };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchDoNotOptimize(bnchSumColumns(bnchGridSize, [&Grid](int Row, int Col) { return Grid(Row, Col); }));
+		}
+		bnchSetItemsPerIteration(bnchGridSize * bnchGridSize);
+	});
+
+	// - stencils (stnclEngine.h): one diffusion step over the same grid, nested Row/Col loops w bounds checks vs stnclDiffuse
+	bnchRegister("diffuse 1024x1024, nested loops", [RowMajor](std::uint64_t Iterations) {
+		constexpr int Weights[3][3]{ { 0, 1, 0 }, { 1, 4, 1 }, { 0, 1, 0 } };
+		const grdGrid2D<int>& Source{ *RowMajor };
+		grdGrid2D<int> Destination{ bnchGridSize, bnchGridSize };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (int Row{ 0 }; Row < bnchGridSize; ++Row) {
+				for (int Col{ 0 }; Col < bnchGridSize; ++Col) {
+					int Sum{ 0 };
+					for (int dy{ -1 }; dy <= 1; ++dy) {
+						for (int dx{ -1 }; dx <= 1; ++dx) {
+							if (Row + dy < 0 || Row + dy >= bnchGridSize || Col + dx < 0 || Col + dx >= bnchGridSize) continue;
+							Sum += Source(Row + dy, Col + dx) * Weights[dy + 1][dx + 1];
+						}
+					}
+					Destination(Row, Col) = ((Sum >> 3) * 230) >> 8;
+				}
+			}
+			bnchDoNotOptimize(Destination.grdRowData(0));
+		}
+		bnchSetItemsPerIteration(bnchGridSize * bnchGridSize);
+	});
+	bnchRegister("diffuse 1024x1024, stnclDiffuse", [RowMajor](std::uint64_t Iterations) {
+		grdGrid2D<int> Destination{ bnchGridSize, bnchGridSize };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			stnclDiffuse(*RowMajor, Destination, 230);
+			bnchDoNotOptimize(Destination.grdRowData(0));
+		}
+		bnchSetItemsPerIteration(bnchGridSize * bnchGridSize);
+	});
+
+	// - sparse world (sprsGrid.h): 64k occupied cells spread over a 2048x2048 corner of the world
+	//random - 4096 reads and writes of random occupied cells, walk - an agent stepping around, reading the 3x3 around it
+	//the paging grid keeps only 64 of the 1024 touched chunks in memory, the rest go to its backing file
+	constexpr int bnchWorldSize{ 2048 };
+	constexpr int bnchOccupied{ 65'536 };
+	constexpr int bnchAccesses{ 4096 };
+	auto Occupied{ std::make_shared<std::vector<std::pair<std::int32_t, std::int32_t>>>() };
+	std::uint32_t WorldSeed{ 17 };
+	for (int Cell{ 0 }; Cell < bnchOccupied; ++Cell) {
+		Occupied->push_back({ static_cast<std::int32_t>(bnchRandom(WorldSeed) % bnchWorldSize), static_cast<std::int32_t>(bnchRandom(WorldSeed) % bnchWorldSize) });
+	}
+	const auto bnchCellKey{ [](std::int32_t X, std::int32_t Y) {
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(X)) << 32) | static_cast<std::uint32_t>(Y);
+	} };
+	auto Hashed{ std::make_shared<std::unordered_map<std::uint64_t, int>>() };
+	auto Chunked{ std::make_shared<sprsGrid>(4096, "", 0) };
+	auto Paged{ std::make_shared<sprsGrid>(64, "BenchmarkChunks.bin", 1024) };
+	for (const auto& [X, Y] : *Occupied) {
+		(*Hashed)[bnchCellKey(X, Y)] = 1;
+		Chunked->sprsSet(X, Y, 1);
+		Paged->sprsSet(X, Y, 1);
+	}
+	bnchRegister("sparse random x4096, std::unordered_map", [Occupied, Hashed, bnchCellKey](std::uint64_t Iterations) {
+		std::uint32_t Seed{ 23 };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (int Access{ 0 }; Access < bnchAccesses; ++Access) {
+				const auto& [X, Y] { (*Occupied)[bnchRandom(Seed) % bnchOccupied] };
+				++(*Hashed)[bnchCellKey(X, Y)];
+			}
+		}
+		bnchSetItemsPerIteration(bnchAccesses);
+	});
+	for (const auto& Case : { std::pair{ "sprsGrid", Chunked }, std::pair{ "sprsGrid, paging", Paged } }) {
+		bnchRegister(std::string{ "sparse random x4096, " } + Case.first, [Occupied, Grid = Case.second](std::uint64_t Iterations) {
+			std::uint32_t Seed{ 23 };
+			for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+				for (int Access{ 0 }; Access < bnchAccesses; ++Access) {
+					const auto& [X, Y] { (*Occupied)[bnchRandom(Seed) % bnchOccupied] };
+					Grid->sprsSet(X, Y, Grid->sprsGet(X, Y) + 1);
+				}
+			}
+			bnchSetItemsPerIteration(bnchAccesses);
+			bnchSetCounter("resident_chunks", static_cast<double>(Grid->sprsResidentCount()));
+		});
+	}
+	bnchRegister("sparse walk x4096 3x3, std::unordered_map", [Hashed, bnchCellKey](std::uint64_t Iterations) {
+		std::uint32_t Seed{ 29 };
+		std::int32_t X{ bnchWorldSize / 2 }, Y{ bnchWorldSize / 2 };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			int Total{ 0 };
+			for (int Step{ 0 }; Step < bnchAccesses; ++Step) {
+				X = std::clamp<std::int32_t>(X + static_cast<std::int32_t>(bnchRandom(Seed) % 3) - 1, 1, bnchWorldSize - 2);
+				Y = std::clamp<std::int32_t>(Y + static_cast<std::int32_t>(bnchRandom(Seed) % 3) - 1, 1, bnchWorldSize - 2);
+				for (std::int32_t dy{ -1 }; dy <= 1; ++dy) {
+					for (std::int32_t dx{ -1 }; dx <= 1; ++dx) {
+						const auto Found{ Hashed->find(bnchCellKey(X + dx, Y + dy)) };
+						if (Found != Hashed->end()) Total += Found->second;
+					}
+				}
+			}
+			bnchDoNotOptimize(Total);
+		}
+		bnchSetItemsPerIteration(bnchAccesses);
+	});
+	for (const auto& Case : { std::pair{ "sprsGrid", Chunked }, std::pair{ "sprsGrid, paging", Paged } }) {
+		bnchRegister(std::string{ "sparse walk x4096 3x3, " } + Case.first, [Grid = Case.second](std::uint64_t Iterations) {
+			std::uint32_t Seed{ 29 };
+			std::int32_t X{ bnchWorldSize / 2 }, Y{ bnchWorldSize / 2 };
+			int Neighbourhood[3][3];
+			for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+				int Total{ 0 };
+				for (int Step{ 0 }; Step < bnchAccesses; ++Step) {
+					X = std::clamp<std::int32_t>(X + static_cast<std::int32_t>(bnchRandom(Seed) % 3) - 1, 1, bnchWorldSize - 2);
+					Y = std::clamp<std::int32_t>(Y + static_cast<std::int32_t>(bnchRandom(Seed) % 3) - 1, 1, bnchWorldSize - 2);
+					Grid->sprsGetNeighbourhood(X, Y, Neighbourhood);
+					for (const auto& Row : Neighbourhood) {
+						for (int Cell : Row) Total += Cell;
+					}
+				}
+				bnchDoNotOptimize(Total);
+			}
+			bnchSetItemsPerIteration(bnchAccesses);
+		});
+	}
+
+	// - pathfinding (pthfPathfinder.h): a 1024x1024 cost map w 10% walls, 256 queries to goals up to 64 cells away
+	constexpr int bnchMapSize{ 1024 };
+	constexpr int bnchQueries{ 256 };
+	auto Costs{ std::make_shared<grdGrid2D<int>>(bnchMapSize, bnchMapSize, 1) };
+	auto Queries{ std::make_shared<std::vector<std::pair<pthfCell, pthfCell>>>() };
+	std::uint32_t PathSeed{ 31 };
+	for (int Row{ 0 }; Row < bnchMapSize; ++Row) {
+		for (int Col{ 0 }; Col < bnchMapSize; ++Col) {
+			(*Costs)(Row, Col) = bnchRandom(PathSeed) % 10 == 0 ? 0 : 1 + static_cast<int>(bnchRandom(PathSeed) % 4);
+		}
+	}
+	for (int Query{ 0 }; Query < bnchQueries; ++Query) {
+		const pthfCell Start{ static_cast<int>(bnchRandom(PathSeed) % bnchMapSize), static_cast<int>(bnchRandom(PathSeed) % bnchMapSize) };
+		const pthfCell Goal{ std::clamp(Start.Row + static_cast<int>(bnchRandom(PathSeed) % 129) - 64, 0, bnchMapSize - 1),
+			std::clamp(Start.Col + static_cast<int>(bnchRandom(PathSeed) % 129) - 64, 0, bnchMapSize - 1) };
+		(*Costs)(Start.Row, Start.Col) = (*Costs)(Goal.Row, Goal.Col) = 1;
+		Queries->push_back({ Start, Goal });
+	}
+	bnchRegister("pthfFindPath x256, 1024x1024", [Costs, Queries](std::uint64_t Iterations) {
+		std::vector<pthfCell> Path;
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (const auto& [Start, Goal] : *Queries) {
+				pthfFindPath(*Costs, Start, Goal, Path);
+				bnchDoNotOptimize(Path.data());
+			}
+		}
+		bnchSetItemsPerIteration(bnchQueries);
+	});
+	//the cache is filled here, so the case only measures repeated queries
+	auto Cache{ std::make_shared<pthfPathCache>(*Costs) };
+	for (const auto& [Start, Goal] : *Queries) Cache->pthfFind(Start, Goal);
+	bnchRegister("pthfPathCache x256, 1024x1024, repeated", [Costs, Queries, Cache](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (const auto& [Start, Goal] : *Queries) bnchDoNotOptimize(Cache->pthfFind(Start, Goal));
+		}
+		bnchSetItemsPerIteration(bnchQueries);
+	});
+	bnchRegister("pthfFlowField build, 1024x1024", [Costs, Queries](std::uint64_t Iterations) {
+		pthfFlowField Field;
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Field.pthfBuild(*Costs, Queries->front().second);
+			bnchDoNotOptimize(Field);
+		}
+		bnchSetItemsPerIteration(bnchMapSize * bnchMapSize);
+	});
+
+	// - faction queries (frltFactionRelations.h): who's hostile to the Undead, out of the 32768 in range (of 65536)
+	constexpr int bnchFactionEntities{ 65'536 };
+	auto Horde{ std::make_shared<frltFactionColumn<enmFaction, enmFactionCount>>() };
+	auto InRange{ std::make_shared<frltEntitySet>(bnchFactionEntities) };
+	std::uint32_t FactionSeed{ 37 };
+	for (int Entity{ 0 }; Entity < bnchFactionEntities; ++Entity) {
+		Horde->frltAdd(static_cast<enmFaction>(bnchRandom(FactionSeed) % enmFactionCount));
+		if (bnchRandom(FactionSeed) & 1) InRange->frltInsert(Entity);
+	}
+	bnchRegister("hostile to Undead x65536, per entity", [Horde, InRange](std::uint64_t Iterations) {
+		frltEntitySet Hostiles{ bnchFactionEntities };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Hostiles.frltClear();
+			for (int Entity{ 0 }; Entity < bnchFactionEntities; ++Entity) {
+				if (InRange->frltContains(Entity) && enmRelationTable.frltIsHostile(Horde->frltGetFaction(Entity), enmFaction::Undead)) {
+					Hostiles.frltInsert(Entity);
+				}
+			}
+			bnchDoNotOptimize(Hostiles.frltWords().data());
+		}
+		bnchSetItemsPerIteration(bnchFactionEntities);
+	});
+	bnchRegister("hostile to Undead x65536, frltQueryHostile", [Horde, InRange](std::uint64_t Iterations) {
+		frltEntitySet Hostiles;
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Horde->frltQueryHostile(enmRelationTable, enmFaction::Undead, *InRange, Hostiles);
+			bnchDoNotOptimize(Hostiles.frltWords().data());
+		}
+		bnchSetItemsPerIteration(bnchFactionEntities);
+	});
+
+	// - faction storage (fprtStorage.h): total health of the Dragons, 1% of 100k entities
+	constexpr int bnchStored{ 100'000 };
+	struct bnchEntity {
+		enmFaction Faction;
+		int Health;
+	};
+	auto Everyone{ std::make_shared<std::vector<bnchEntity>>() };
+	auto Partitioned{ std::make_shared<fprtStorage<int, enmFaction, enmFactionCount>>() };
+	Partitioned->fprtReserve(bnchStored);
+	std::uint32_t StoredSeed{ 41 };
+	for (int Entity{ 0 }; Entity < bnchStored; ++Entity) {
+		const enmFaction Faction{ bnchRandom(StoredSeed) % 100 == 0 ? enmFaction::Dragon : static_cast<enmFaction>(bnchRandom(StoredSeed) % 3) };
+		const int Health{ static_cast<int>(bnchRandom(StoredSeed) % 500) };
+		Everyone->push_back({ Faction, Health });
+		Partitioned->fprtAdd(Faction, Health);
+	}
+	bnchRegister("Dragon health x100k, check everyone", [Everyone](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			int Total{ 0 };
+			for (const bnchEntity& Entity : *Everyone) {
+				if (Entity.Faction == enmFaction::Dragon) Total += Entity.Health;
+			}
+			bnchDoNotOptimize(Total);
+		}
+	});
+	bnchRegister("Dragon health x100k, fprtAll", [Partitioned](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			int Total{ 0 };
+			for (int Health : Partitioned->fprtAll(enmFaction::Dragon)) Total += Health;
+			bnchDoNotOptimize(Total);
+		}
+	});
+}
+
+//categories for measuring LOG itself - Verbose is compiled out, Log is filtered at run time (until clgSetLevel), Warning is written
+LOG_CATEGORY(LogBenchmark, Display, Log, Deferred);
+LOG_CATEGORY(LogBenchmarkNow, Log, Log, Immediate);
+
+void bnchRegisterSystems() {
+	// - number theory (nmthNumberTheory.h): divisors of 4096 random numbers below 10^7
+	constexpr std::uint32_t bnchSieveLimit{ 10'000'000 };
+	constexpr int bnchNumbers{ 4096 };
+	auto Sieve{ std::make_shared<nmthSieve>(bnchSieveLimit) };
+	auto Numbers{ std::make_shared<std::vector<std::uint32_t>>(bnchNumbers) };
+	std::uint32_t NumberSeed{ 43 };
+	for (std::uint32_t& Number : *Numbers) Number = bnchRandom(NumberSeed) % bnchSieveLimit + 1;
+	bnchRegister("nmthSieve build, 10^7", [](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			nmthSieve Built{ bnchSieveLimit };
+			bnchDoNotOptimize(Built);
+		}
+	});
+	bnchRegister("divisors x4096 < 10^7, trial division", [Numbers](std::uint64_t Iterations) {
+		std::vector<std::uint32_t> Divisors(nmthMaxDivisors32);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (std::uint32_t Number : *Numbers) {
+				int Count{ 0 };
+				for (std::uint32_t Divisor{ 1 }; Divisor * Divisor <= Number; ++Divisor) {
+					if (Number % Divisor) continue;
+					Divisors[Count++] = Divisor;
+					if (Divisor * Divisor != Number) Divisors[Count++] = Number / Divisor;
+				}
+				bnchDoNotOptimize(Count);
+			}
+		}
+		bnchSetItemsPerIteration(bnchNumbers);
+	});
+	bnchRegister("divisors x4096 < 10^7, nmthDivisors", [Numbers](std::uint64_t Iterations) {
+		std::vector<std::uint32_t> Divisors(nmthMaxDivisors32);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (std::uint32_t Number : *Numbers) bnchDoNotOptimize(nmthDivisors(Number, Divisors.data(), nmthMaxDivisors32));
+		}
+		bnchSetItemsPerIteration(bnchNumbers);
+	});
+	bnchRegister("divisors x4096 < 10^7, nmthSieve", [Sieve, Numbers](std::uint64_t Iterations) {
+		std::vector<std::uint32_t> Divisors(nmthMaxDivisors32);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (std::uint32_t Number : *Numbers) bnchDoNotOptimize(Sieve->nmthDivisors(Number, Divisors.data(), nmthMaxDivisors32));
+		}
+		bnchSetItemsPerIteration(bnchNumbers);
+	});
+	bnchRegister("nmthSegmentedSieve next 1M window, from 10^12", [](std::uint64_t Iterations) {
+		nmthSegmentedSieve Window{ 1'000'000'000'000ull, 1 << 20 };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Window.nmthNextWindow();
+			bnchDoNotOptimize(Window);
+		}
+		bnchSetItemsPerIteration(1 << 20);
+	});
+
+	// - divisibility by a divisor only known at run time: %, nmthIsDivisibleBy, and fmodDivisor's precomputed reciprocal
+	const std::uint32_t RuntimeDivisor{ bnchRandom(NumberSeed) % 60 + 2 };
+	bnchRegister("divisible x4096, %", [Numbers, RuntimeDivisor](std::uint64_t Iterations) {
+		std::vector<std::uint8_t> Divisible(bnchNumbers);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (int Index{ 0 }; Index < bnchNumbers; ++Index) Divisible[Index] = (*Numbers)[Index] % RuntimeDivisor == 0;
+			bnchDoNotOptimize(Divisible.data());
+		}
+		bnchSetItemsPerIteration(bnchNumbers);
+	});
+	bnchRegister("divisible x4096, nmthIsDivisibleBy", [Numbers, RuntimeDivisor](std::uint64_t Iterations) {
+		std::vector<std::uint8_t> Divisible(bnchNumbers);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			nmthIsDivisibleBy(Numbers->data(), bnchNumbers, RuntimeDivisor, Divisible.data());
+			bnchDoNotOptimize(Divisible.data());
+		}
+		bnchSetItemsPerIteration(bnchNumbers);
+	});
+	bnchRegister("divisible x4096, fmodIsDivisible", [Numbers, RuntimeDivisor](std::uint64_t Iterations) {
+		const fmodDivisor Fast{ RuntimeDivisor };
+		std::vector<std::uint8_t> Divisible(bnchNumbers);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (int Index{ 0 }; Index < bnchNumbers; ++Index) Divisible[Index] = Fast.fmodIsDivisible((*Numbers)[Index]);
+			bnchDoNotOptimize(Divisible.data());
+		}
+		bnchSetItemsPerIteration(bnchNumbers);
+	});
+	bnchRegister("remainder x4096, %", [Numbers, RuntimeDivisor](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			std::uint32_t Total{ 0 };
+			for (std::uint32_t Number : *Numbers) Total += Number % RuntimeDivisor;
+			bnchDoNotOptimize(Total);
+		}
+		bnchSetItemsPerIteration(bnchNumbers);
+	});
+	bnchRegister("remainder x4096, fmodMod", [Numbers, RuntimeDivisor](std::uint64_t Iterations) {
+		const fmodDivisor Fast{ RuntimeDivisor };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			std::uint32_t Total{ 0 };
+			for (std::uint32_t Number : *Numbers) Total += Fast.fmodMod(Number);
+			bnchDoNotOptimize(Total);
+		}
+		bnchSetItemsPerIteration(bnchNumbers);
+	});
+
+	// - staggered scheduler (fmodScheduler.h): who's due this tick, out of 10k entities on periods 1..60
+	constexpr int bnchScheduled{ 10'000 };
+	auto Scheduler{ std::make_shared<fmodScheduler>() };
+	auto Periods{ std::make_shared<std::vector<std::uint32_t>>() };
+	auto Phases{ std::make_shared<std::vector<std::uint32_t>>() };
+	std::uint32_t ScheduleSeed{ 47 };
+	for (std::uint32_t Entity{ 0 }; Entity < bnchScheduled; ++Entity) {
+		const std::uint32_t Period{ bnchRandom(ScheduleSeed) % 60 + 1 };
+		Periods->push_back(Period);
+		Phases->push_back(Scheduler->fmodGetPhase(Scheduler->fmodAdd(Entity, Period)));
+	}
+	bnchRegister("due x10k, Tick % Period per entity", [Periods, Phases](std::uint64_t Iterations) {
+		std::vector<std::uint32_t> Due;
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			const std::uint32_t Tick{ static_cast<std::uint32_t>(i) };
+			Due.clear();
+			for (std::uint32_t Entity{ 0 }; Entity < bnchScheduled; ++Entity) {
+				if (Tick % (*Periods)[Entity] == (*Phases)[Entity]) Due.push_back(Entity);
+			}
+			bnchDoNotOptimize(Due.data());
+		}
+		bnchSetItemsPerIteration(bnchScheduled);
+	});
+	bnchRegister("due x10k, fmodDue", [Scheduler](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchDoNotOptimize(Scheduler->fmodDue(static_cast<std::uint32_t>(i)).data());
+		}
+		bnchSetItemsPerIteration(bnchScheduled);
+	});
+
+	// - asynchronous logger (alogLogger.h): what the calling thread pays for one combat line
+	//the sink is bnchNullStream, so this is only the caller's side - std::cout would add the console on top of the first one
+	//a caller logging nonstop outruns the background thread, so w Drop most of these lines are dropped (see the counter),
+	//and w Block the caller ends up waiting on the formatting - on a single core, that's all of it
+	bnchRegister("combat line, std::ostream <<", [](std::uint64_t Iterations) {
+		const intrnSymbol Name{ "Bonker" };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			bnchNullStream << '\n' << Name << " Taking Damage: " << static_cast<int>(i & 63);
+		}
+	});
+	for (const alogPolicy Policy : { alogPolicy::Drop, alogPolicy::Block }) {
+		bnchRegister(Policy == alogPolicy::Drop ? "combat line, alogWrite (Drop)" : "combat line, alogWrite (Block)", [Policy](std::uint64_t Iterations) {
+			const intrnSymbol Name{ "Bonker" };
+			const std::uint64_t DroppedBefore{ alogDropped() };
+			alogSetPolicy(Policy);
+			for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+				alogWrite("\n{} Taking Damage: {}", Name, static_cast<int>(i & 63));
+			}
+			alogSetPolicy(alogPolicy::Drop);
+			bnchSetCounter("dropped_per_iteration", static_cast<double>(alogDropped() - DroppedBefore) / static_cast<double>(Iterations));
+		});
+	}
+
+	// - LOG (clgLog.h): a call that is compiled out should cost the same as "empty scope"
+	bnchRegister("LOG below compile-time level", [](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			LOG(LogBenchmark, Verbose, "Turn {}", i);
+			bnchDoNotOptimize(i);
+		}
+	});
+	bnchRegister("LOG below run-time level", [](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			LOG(LogBenchmark, Log, "Turn {}", i);
+			bnchDoNotOptimize(i);
+		}
+	});
+	bnchRegister("LOG Deferred", [](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			LOG(LogBenchmark, Warning, "Turn {}", i);
+			bnchDoNotOptimize(i);
+		}
+	});
+	bnchRegister("LOG Immediate", [](std::uint64_t Iterations) {
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			LOG(LogBenchmarkNow, Log, "Turn {}", i);
+			bnchDoNotOptimize(i);
+		}
+	});
+
+	// - decisions (dcsnDecisionTable.h): 4096 enemies w mixed health and flags, sorted into one list per action
+	constexpr int bnchDeciders{ 4096 };
+	struct bnchDecisionColumns {
+		std::vector<int> Health = std::vector<int>(bnchDeciders);
+		std::unique_ptr<bool[]> CanHeal{ new bool[bnchDeciders] };
+		std::unique_ptr<bool[]> IsHostile{ new bool[bnchDeciders] };
+		std::unique_ptr<bool[]> CanSeePlayer{ new bool[bnchDeciders] };
+	};
+	auto Deciders{ std::make_shared<bnchDecisionColumns>() };
+	std::uint32_t DecisionSeed{ 53 };
+	for (int Entity{ 0 }; Entity < bnchDeciders; ++Entity) {
+		Deciders->Health[Entity] = static_cast<int>(bnchRandom(DecisionSeed) % 220) - 20;
+		Deciders->CanHeal[Entity] = bnchRandom(DecisionSeed) & 1;
+		Deciders->IsHostile[Entity] = bnchRandom(DecisionSeed) & 1;
+		Deciders->CanSeePlayer[Entity] = bnchRandom(DecisionSeed) & 1;
+	}
+	bnchRegister("decide x4096, if/else per enemy", [Deciders](std::uint64_t Iterations) {
+		std::vector<std::uint32_t> Lists[dcsnActionCount];
+		for (std::vector<std::uint32_t>& List : Lists) List.reserve(bnchDeciders);
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (std::vector<std::uint32_t>& List : Lists) List.clear();
+			for (int Entity{ 0 }; Entity < bnchDeciders; ++Entity) {
+				const int Health{ Deciders->Health[Entity] };
+				const int Bucket{ Health <= 0 ? 0 : Health <= dcsnLowHealth ? 1 : 2 };
+				const dcsnAction Action{ dcsnDecide(Bucket, Deciders->CanHeal[Entity], Deciders->IsHostile[Entity], Deciders->CanSeePlayer[Entity]) };
+				Lists[static_cast<int>(Action)].push_back(static_cast<std::uint32_t>(Entity));
+			}
+			bnchDoNotOptimize(Lists[0].data());
+		}
+		bnchSetItemsPerIteration(bnchDeciders);
+	});
+	bnchRegister("decide x4096, dcsnEvaluate", [Deciders](std::uint64_t Iterations) {
+		const dcsnColumns Columns{ Deciders->Health.data(), Deciders->CanHeal.get(), Deciders->IsHostile.get(), Deciders->CanSeePlayer.get(), bnchDeciders };
+		dcsnBatch Batch;
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Batch.dcsnEvaluate(Columns);
+			bnchDoNotOptimize(Batch.dcsnEntities(dcsnAction::None));
+		}
+		bnchSetItemsPerIteration(bnchDeciders);
+	});
+
+	// - behavior trees (bhvrBehaviorTree.h): bhvrGoblinTree over 4096 goblins, vs the same rules hand-written per goblin
+	//the tree is never faster than hand-written code - what to watch is its entity-ticks per second
+	constexpr int bnchGoblins{ 4096 };
+	auto GoblinHealth{ std::make_shared<std::vector<int>>(bnchGoblins) };
+	std::uint32_t GoblinSeed{ 59 };
+	for (int& Health : *GoblinHealth) Health = static_cast<int>(bnchRandom(GoblinSeed) % 220) - 20;
+	bnchRegister("goblins x4096, if/else", [GoblinHealth](std::uint64_t Iterations) {
+		int Actions[3]{};
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			for (int Health : *GoblinHealth) {
+				if (Health <= 0) ++Actions[0];
+				else if (Health <= 50) ++Actions[1];
+				else ++Actions[2];
+			}
+			bnchDoNotOptimize(Actions);
+		}
+		bnchSetItemsPerIteration(bnchGoblins);
+	});
+	bnchRegister("goblins x4096, bhvrTick", [GoblinHealth](std::uint64_t Iterations) {
+		int Actions[3]{};
+		bhvrLibrary Library;
+		Library.bhvrRegister("IsDead", [GoblinHealth](const std::uint32_t* Entities, int Count, bhvrStatus* Results) {
+			for (int i{ 0 }; i < Count; ++i) Results[i] = (*GoblinHealth)[Entities[i]] <= 0 ? bhvrStatus::Success : bhvrStatus::Failure;
+		});
+		Library.bhvrRegister("IsLowHealth", [GoblinHealth](const std::uint32_t* Entities, int Count, bhvrStatus* Results) {
+			for (int i{ 0 }; i < Count; ++i) Results[i] = (*GoblinHealth)[Entities[i]] <= 50 ? bhvrStatus::Success : bhvrStatus::Failure;
+		});
+		const char* ActionNames[3]{ "DropLoot", "Enrage", "Attack" };
+		for (int Action{ 0 }; Action < 3; ++Action) {
+			Library.bhvrRegister(ActionNames[Action], [&Actions, Action](const std::uint32_t*, int Count, bhvrStatus* Results) {
+				Actions[Action] += Count;
+				std::fill(Results, Results + Count, bhvrStatus::Success);
+			});
+		}
+		bhvrTree Tree;
+		std::string Error;
+		if (!Tree.bhvrCompile(bhvrGoblinTree, Library, Error)) return;
+		bhvrRunner Goblins{ Tree, Library, bnchGoblins };
+		const std::uint64_t TicksBefore{ Goblins.bhvrEntityTicks() };
+		for (std::uint64_t i{ 0 }; i < Iterations; ++i) {
+			Goblins.bhvrTick();
+			bnchDoNotOptimize(Actions);
+		}
+		bnchSetItemsPerIteration(static_cast<double>(Goblins.bhvrEntityTicks() - TicksBefore) / static_cast<double>(Iterations));
+	});
+
+	// - simulate/render pipeline (dbufPipeline.h): 100k actor positions per frame, one stage after the other vs overlapped
+	//(overlapping only helps w a second core free for the render stage)
+	constexpr int bnchActors{ 100'000 };
+	for (const bool Overlap : { false, true }) {
+		bnchRegister(Overlap ? "frame x100k actors, dbufRun overlapped" : "frame x100k actors, dbufRun in sequence", [Overlap](std::uint64_t Iterations) {
+			dbufPipeline<std::vector<int>> Frames{ std::vector<int>(bnchActors, 0) };
+			std::uint64_t Rendered{ 0 };
+			const dbufTiming Timing{ Frames.dbufRun(static_cast<int>(Iterations),
+				[](const std::vector<int>& Current, std::vector<int>& Next) {
+					for (int Actor{ 0 }; Actor < bnchActors; ++Actor) Next[Actor] = Current[Actor] + 1 + (Actor & 3);
+				},
+				[&Rendered](const std::vector<int>& Frame) {
+					for (int Position : Frame) Rendered += static_cast<std::uint64_t>(Position);
+				}, Overlap) };
+			bnchDoNotOptimize(Rendered);
+			bnchSetCounter("worst_frame_ms", Timing.WorstFrameMs);
+		});
+	}
+}
+
+int bnchRunBenchmarks() {
+	bnchRegisterIdioms();
+	bnchRegisterModules();
+	bnchRegisterData();
+	bnchRegisterWorld();
+	bnchRegisterSystems();
+	std::streambuf* Console{ std::cout.rdbuf(&bnchNullSink) };
+	alogSetSink(bnchNullStream);
+	const std::vector<bnchResult> Results{ bnchRunAll() };
+	alogSetSink(std::cout);
+	std::cout.rdbuf(Console);
+	bnchPrint(std::cout, Results);
+	std::ofstream Json{ "BenchmarkResults.json" };
+	bnchWriteJson(Json, Results);
+	std::cout << "\nWritten to BenchmarkResults.json\n";
+	//the coroutine frames come from a thread_local pool, so they have to go before main() returns
+	bnchClear();
+	return Json ? 0 : 1;
+}
+#endif
+
+//checks that, unlike assert(), stay in Release and Benchmark builds too
+#include "chkCheck.h"
 
 int main() {
+	//the modules are checked on their own first, in every configuration (see chkCheck.h)
+	if (chkRunModuleChecks()) return 1;
+#ifdef BENCHMARK_BUILD
+	return bnchRunBenchmarks();
+#endif
+
 	Level = Level + 1;
 	Level += 2;
 	Level -= 7;
@@ -2328,6 +3688,14 @@ int main() {
 
 	int Number{ 2'000'000'000 };
 	Number += 1'000'000'000; // OVERFLOW when value to big it wraps around to other side of width range (w - in that case)
+	//saturating arithmetic sticks to the limit instead, and can clamp into our own range in the same pass
+	int32_t SaturatedNumber{ 2'000'000'000 };
+	strtAddClamp(&SaturatedNumber, 1, 1'000'000'000, INT32_MIN, INT32_MAX);
+	int16_t PartyHealth[4]{ 100, 40, 5, 0 };
+	strtSubClamp(PartyHealth, 4, int16_t{ 30 }, int16_t{ 0 }, int16_t{ 100 }); // area damage
+	strtAddClamp(PartyHealth, 4, int16_t{ 20 }, int16_t{ 0 }, int16_t{ 100 }); // healing
+	std::cout << "\nSaturated: " << SaturatedNumber << ", party health: " << PartyHealth[0]
+		<< " " << PartyHealth[1] << " " << PartyHealth[2] << " " << PartyHealth[3];
 
 	int8_t PositiveNumber{ 100 };
 	int8_t NegativeNumber{ -100 };
@@ -2413,6 +3781,17 @@ int main() {
 		? RunAway()
 		: Attack(); // Contentious thing, better not nest terneries
 
+	int CrowdHealth[6]{ 0, 30, 30, 80, 80, 120 }; // same rules for 6 enemies at once, inputs stored as columns
+	bool CrowdCanHeal[6]{ false, true, false, false, false, false };
+	bool CrowdIsHostile[6]{ true, true, true, true, true, false };
+	bool CrowdCanSeePlayer[6]{ false, false, false, true, false, false };
+	dcsnBatch CrowdDecisions;
+	CrowdDecisions.dcsnEvaluate({ CrowdHealth, CrowdCanHeal, CrowdIsHostile, CrowdCanSeePlayer, 6 });
+	for (int i{ 0 }; i < CrowdDecisions.dcsnCount(dcsnAction::RunAway); ++i) { // each action then runs over its own batch
+		cout << "\nEnemy " << CrowdDecisions.dcsnEntities(dcsnAction::RunAway)[i] << ":";
+		RunAway();
+	}
+
 	// Switch Statements
 	switch (Day) {
 	case 1: // Is day == 1?
@@ -2629,6 +4008,10 @@ int main() {
 	IsDivisibleBy(6, {});
 	IsDivisibleBy(16, {});
 	IsDivisibleBy(9, {});
+	std::uint32_t Waves[12]{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 }; // checking many numbers at once - every 3rd wave is a boss wave
+	std::uint8_t IsBossWave[12];
+	nmthIsDivisibleBy(Waves, 12, 3, IsBossWave);
+	cout << "\nWave 9 is a boss wave: " << (IsBossWave[8] ? "yes" : "no");
 
 	cout << '\n' << 0 % 3 << ", " << 1 % 3 << ", " << 2 % 3; // cycle of modulus operator, length is determined by the right operand (3 - got a repeating pattern of 3 numbers)
 	cout << '\n' << 3 % 3 << ", " << 4 % 3 << ", " << 5 % 3; // modulus arithmetics has a tendency to "wrap around" after reaching certain value, can be useful when paired with loops
@@ -2638,6 +4021,15 @@ int main() {
 		cout << i << " ";
 		if (i % 3 == 0) cout << '\n'; // this can be used to insert a line break on every  third iteration
 	}
+	fmodScheduler AIScheduler; // 9 goblins thinking every 3rd tick - 3 of them each tick, rather than all 9 on every 3rd one
+	for (std::uint32_t Goblin{ 0 }; Goblin < 9; ++Goblin) {
+		AIScheduler.fmodAdd(Goblin, 3);
+	}
+	for (std::uint32_t Tick{ 0 }; Tick < 3; ++Tick) {
+		cout << "Tick " << Tick << ":";
+		for (std::uint32_t Goblin : AIScheduler.fmodDue(Tick)) cout << " " << Goblin;
+		cout << '\n';
+	}
 
 	// Abstractions and Classes
 	Monster Bonker; // class grants the ability to create new objects of that class
@@ -2742,12 +4134,55 @@ int main() {
 	Dave.Render(); // now Dave can perform functions of all his parent classes
 	Dave.Attack();
 	Dave.Fly();
+	dbufPipeline<std::vector<int>> ActorFrames{ std::vector<int>(3, 0) }; // positions of 3 actors, simulated and rendered at the same time
+	const dbufTiming ActorTiming{ ActorFrames.dbufRun(60,
+		[](const std::vector<int>& Current, std::vector<int>& Next) { // writes frame N+1...
+			Next = Current;
+			for (int& Position : Next) ++Position;
+		},
+		[&Rock](const std::vector<int>& Frame) { // ...while frame N is rendered on another thread
+			for (std::size_t i{ 0 }; i < Frame.size(); ++i) Rock.Render();
+		}) };
+	cout << "\nRendered " << ActorTiming.Frames << " frames, " << ActorTiming.AverageFrameMs << " ms each, actors now at " << ActorFrames.dbufFront()[0];
 
 	// Protected Class Members
 	Healer Player;
 	cout << "\nHealth: " << Player.GetHealth();
 	Player.Heal(25);
 	cout << "\nHealth: " << Player.GetHealth();
+	int BehaviorHealth[5]{ 0, 30, 80, 150, 20 }; // 5 goblins running the designers' tree, health stored as a column
+	bhvrLibrary Behaviors;
+	Behaviors.bhvrRegister("IsDead", [&](const std::uint32_t* Entities, int Count, bhvrStatus* Results) {
+		for (int i{ 0 }; i < Count; ++i) Results[i] = BehaviorHealth[Entities[i]] <= 0 ? bhvrStatus::Success : bhvrStatus::Failure;
+	});
+	Behaviors.bhvrRegister("IsLowHealth", [&](const std::uint32_t* Entities, int Count, bhvrStatus* Results) {
+		for (int i{ 0 }; i < Count; ++i) Results[i] = BehaviorHealth[Entities[i]] <= 50 ? bhvrStatus::Success : bhvrStatus::Failure;
+	});
+	const auto BehaviorAction{ [](const char* Name, auto Action) { // every leaf is called once per tick, w all the entities waiting at it
+		return [Name, Action](const std::uint32_t* Entities, int Count, bhvrStatus* Results) {
+			cout << "\n" << Name << " x" << Count;
+			for (int i{ 0 }; i < Count; ++i) {
+				Action(Entities[i]);
+				Results[i] = bhvrStatus::Success;
+			}
+		};
+	} };
+	Behaviors.bhvrRegister("DropLoot", BehaviorAction("DropLoot", [&](std::uint32_t) { Smasher.DropLoot(); }));
+	Behaviors.bhvrRegister("Enrage", BehaviorAction("Enrage", [&](std::uint32_t) { Smasher.Enrage(); }));
+	Behaviors.bhvrRegister("Fly", BehaviorAction("Fly", [&](std::uint32_t) { Dave.Fly(); }));
+	Behaviors.bhvrRegister("Heal", BehaviorAction("Heal", [&](std::uint32_t Entity) { BehaviorHealth[Entity] += 25; }));
+	Behaviors.bhvrRegister("Attack", BehaviorAction("Attack", [&](std::uint32_t) { Smasher.Attack(); }));
+	bhvrTree GoblinBehavior, DragonBehavior, HealerBehavior;
+	std::string BehaviorError;
+	if (!GoblinBehavior.bhvrCompile(bhvrGoblinTree, Behaviors, BehaviorError)
+		|| !DragonBehavior.bhvrCompile(bhvrDragonTree, Behaviors, BehaviorError)
+		|| !HealerBehavior.bhvrCompile(bhvrHealerTree, Behaviors, BehaviorError)) {
+		cout << "\nBehavior tree error: " << BehaviorError;
+	}
+	else {
+		bhvrRunner Goblins{ GoblinBehavior, Behaviors, 5 };
+		Goblins.bhvrTick(); // DropLoot x1, Enrage x2, Attack x2
+	}
 
 	// Member Initializer list
 
@@ -3000,6 +4435,39 @@ int main() {
 	rtpGoblin rtpA;
 	rtpDragon rtpB;
 	rtpBattle(&rtpA, &rtpB); //A and B enter Battle() and both using Act() defined in basic class
+	wstpPool BattlePool; // one worker per core (minus the main thread, which helps while it waits)
+	std::vector<int> BattleHealth(10'000, 100);
+	wstpParallelFor(BattlePool, 0, static_cast<int>(BattleHealth.size()), [&](int i) { BattleHealth[i] -= i % 11 * 10; });
+	int BattleSurvivors{ 0 }, BattleFallen{ 0 };
+	wstpTaskGroup BattleReport{ BattlePool }; // fork/join: both counts are taken at the same time, then waited for
+	BattleReport.wstpRun([&] { BattleSurvivors = static_cast<int>(std::count_if(BattleHealth.begin(), BattleHealth.end(), [](int Health) { return Health > 0; })); });
+	BattleReport.wstpRun([&] { BattleFallen = static_cast<int>(std::count(BattleHealth.begin(), BattleHealth.end(), 0)); });
+	BattleReport.wstpWait();
+	cout << "\nBattles: " << BattleSurvivors << " survived, " << BattleFallen << " fell";
+	//stress check: every index runs exactly once per pass, also when tasks start and wait for groups of their own
+	std::vector<std::atomic<int>> BattleRuns(100'000);
+	for (int Round{ 0 }; Round < 20; ++Round) {
+		wstpParallelFor(BattlePool, 0, static_cast<int>(BattleRuns.size()), [&](int i) { BattleRuns[i].fetch_add(1, std::memory_order_relaxed); });
+	}
+	wstpTaskGroup BattleWaves{ BattlePool };
+	for (int Wave{ 0 }; Wave < 8; ++Wave) {
+		BattleWaves.wstpRun([&, Wave] {
+			wstpTaskGroup Fighters{ BattlePool };
+			for (int i{ Wave }; i < static_cast<int>(BattleRuns.size()); i += 8) {
+				Fighters.wstpRun([&, i] { BattleRuns[i].fetch_add(1, std::memory_order_relaxed); });
+			}
+			Fighters.wstpWait();
+		});
+	}
+	BattleWaves.wstpWait();
+	CHECK(std::all_of(BattleRuns.begin(), BattleRuns.end(), [](const std::atomic<int>& Runs) { return Runs.load() == 21; }));
+	crtnScheduler Scripts;
+	bool SpottedTarget{ false };
+	Scripts.crtnStart(crtnGuardScript(rtpA, rtpB, SpottedTarget));
+	for (int Tick{ 0 }; Tick < 8; ++Tick) {
+		if (Tick == 2) SpottedTarget = true;
+		Scripts.crtnTick(); // only resumes the script on the ticks it's ready
+	}
 
 	slcGoblin slcBonker;
 	slcBattle(slcBonker);
@@ -3062,6 +4530,13 @@ int main() {
 
 	argGreet();
 	MyObject.argGreet();
+	LOG(LogTemp, Error, "Hello!");
+
+	for (int Frame{ 0 }; Frame < 3; ++Frame) {
+		prflUpdateEnemies(10 * (Frame + 1));
+		PROFILE_FRAME();
+	}
+	PROFILE_LOG_FRAME(std::cout);
 
 	// The #include Directive
 
@@ -3100,6 +4575,33 @@ int main() {
 	enmVampire enmEnemy;
 	enmFaction enmEnemyFaction { enmEnemy.enmGetFaction() };
 
+	//a horde of mixed factions - which of the ones in range are hostile to the vampire?
+	frltFactionColumn<enmFaction, enmFactionCount> enmHorde;
+	frltEntitySet enmInRange;
+	for (int i{ 0 }; i < 200; ++i) {
+		enmHorde.frltAdd(static_cast<enmFaction>(i % enmFactionCount));
+	}
+	enmInRange.frltResize(enmHorde.frltSize());
+	for (int i{ 0 }; i < 100; ++i) {
+		enmInRange.frltInsert(i);
+	}
+	frltEntitySet enmHostiles;
+	enmHorde.frltQueryHostile(enmRelationTable, enmEnemyFaction, enmInRange, enmHostiles);
+	std::cout << "\nHostile to the vampire, in range: " << enmHostiles.frltCount();
+
+	//health of every member of the horde, grouped by faction
+	fprtStorage<int, enmFaction, enmFactionCount> enmHordeHealth;
+	fprtId enmTurncoat{ enmHordeHealth.fprtAdd(enmFaction::Goblin, 50) };
+	enmHordeHealth.fprtAdd(enmFaction::Troll, 300);
+	enmHordeHealth.fprtAdd(enmFaction::Dragon, 1000);
+	enmHordeHealth.fprtSetFaction(enmTurncoat, enmFaction::Troll);
+	int enmTrollHealth{ 0 };
+	for (int Health : enmHordeHealth.fprtAll(enmFaction::Troll)) {
+		enmTrollHealth += Health;
+	}
+	std::cout << "\nTrolls: " << enmHordeHealth.fprtCount(enmFaction::Troll)
+		<< ", total health: " << enmTrollHealth;
+
 	// The using Keyword
 	std::string usngString{ "\nUwU" };
 	std::cout << usngString;
@@ -3108,6 +4610,12 @@ int main() {
 
 	usnginteger usngMyNumber{ 41 };
 
+	//health of a whole army, 2 bytes each instead of 4
+	ntrwColumn<0, 10'000, usnginteger> usngArmyHealth(1000, usngHealth::ntrwConstant<100>());
+	usngArmyHealth[0] -= 250;
+	std::cout << "\nFirst soldier: " << usngArmyHealth[0]
+		<< ", army total: " << ntrwSum(usngArmyHealth);
+
 	// Dynamic Arrays using std::vector
 	std::vector dnmcaExpressionVector{
 		"First", "Second", "Third", "Fourth"
@@ -3155,6 +4663,21 @@ int main() {
 	std::cout << "\nSecond Character is now: "
 		<< dnmcaCharacterVector[1].Name;
 
+	//same roster in a slot map - Gandalf is moved into Aragorn's place, rather than everyone after him shifting left
+	sltmSlotMap<dnmcaCharacter> dnmcaRoster;
+	sltmKey dnmcaLegolasKey{ dnmcaRoster.sltmEmplace("Legolas") };
+	sltmKey dnmcaAragornKey{ dnmcaRoster.sltmEmplace("Aragorn") };
+	dnmcaRoster.sltmEmplace("Gandalf");
+	dnmcaRoster.sltmErase(dnmcaAragornKey);
+	std::cout << "\nRoster:";
+	for (const dnmcaCharacter& Character : dnmcaRoster) {
+		std::cout << ' ' << Character.Name;
+	}
+	if (!dnmcaRoster.sltmFind(dnmcaAragornKey)) {
+		std::cout << "\nAragorn's key is no longer valid, "
+			<< dnmcaRoster.sltmFind(dnmcaLegolasKey)->Name << "'s still is";
+	}
+
 	// - modifying array items
 	//we can modify std::vector in usual ways:
 	std::vector dnmcaModificationVector{ 1,2,3,4,5 };
@@ -3193,6 +4716,53 @@ int main() {
 	dnmcafLogBottomRight(dnmcafMyGrid);
 	dnmcafSetCenter(&dnmcafMyGrid, 69);
 	dnmcafLogCenter(&dnmcafMyGrid);
+
+	grdGrid2D<int> dnmcafFlatGrid{ dnmcafMyGrid };
+	dnmcafLogTopLeft(dnmcafFlatGrid);
+	//views refer to the cells of the grid, rather than copying them
+	auto dnmcafMiddleColumn{ dnmcafFlatGrid.grdCol(1) };
+	std::cout << "\nMiddle Column: " << dnmcafMiddleColumn(0, 0)
+		<< ", " << dnmcafMiddleColumn(1, 0) << ", " << dnmcafMiddleColumn(2, 0);
+
+	//a single threat source in the center, spread outwards losing 25 per cell
+	//one pass only reaches the direct neighbours, the corners are 2 cells away - so 2 passes (ping-ponging between the grids)
+	grdGrid2D<int> dnmcafInfluence{ 5, 5 };
+	dnmcafInfluence(2, 2) = 100;
+	grdGrid2D<int> dnmcafScratch{ 5, 5 };
+	for (int Pass{ 0 }; Pass < 2; ++Pass) {
+		stnclPropagateMax(dnmcafInfluence, dnmcafScratch, 25);
+		std::swap(dnmcafInfluence, dnmcafScratch);
+	}
+	std::cout << "\nThreat next to the source: " << dnmcafInfluence(2, 3) // 75
+		<< ", in the corner: " << dnmcafInfluence(0, 0); // 50
+
+	//only the chunk containing the far corner is ever allocated
+	sprsGrid dnmcafWorld{ 64, "WorldChunks.bin", 16 };
+	dnmcafWorld.sprsSet(999'999, 999'999, 7);
+	std::cout << "\nFar corner of the world: " << dnmcafWorld.sprsGet(999'999, 999'999)
+		<< ", chunks allocated: " << dnmcafWorld.sprsChunkCount();
+
+	//a wall down the middle of a 5x5 cost grid, w a gap at the bottom (0 - blocked)
+	grdGrid2D<int> dnmcafCosts{ 5, 5, 1 };
+	for (int Row{ 0 }; Row < 4; ++Row) dnmcafCosts(Row, 2) = 0;
+	std::vector<pthfCell> dnmcafPath;
+	pthfFindPath(dnmcafCosts, { 0, 0 }, { 0, 4 }, dnmcafPath);
+	std::cout << "\nPath around the wall: " << dnmcafPath.size() << " cells";
+	//every unit heading to the same goal just follows the flow field
+	pthfFlowField dnmcafToGoal;
+	dnmcafToGoal.pthfBuild(dnmcafCosts, { 0, 4 });
+	pthfCell dnmcafNextStep{ dnmcafToGoal.pthfNext({ 0, 0 }) };
+	std::cout << "\nFrom the top left, step to: " << dnmcafNextStep.Row << ", " << dnmcafNextStep.Col;
+	//CanSeePlayer for every enemy, from real visibility checks - traced together, and only again when something they depend on changed
+	losQueries dnmcafSight{ dnmcafCosts, 2 };
+	dnmcafSight.losSet(0, { 0, 0 }, { 0, 4 }); // behind the wall
+	dnmcafSight.losSet(1, { 4, 0 }, { 4, 4 }); // through the gap
+	dnmcafSight.losUpdate();
+	CanSeePlayer = dnmcafSight.losCanSee(1);
+	std::cout << "\nCan see the player: " << dnmcafSight.losCanSee(0) << ", " << dnmcafSight.losCanSee(1);
+	dnmcafSight.losSetCell({ 4, 2 }, 0); // closing the gap, only the query through it is traced again
+	dnmcafSight.losUpdate();
+	std::cout << "\nAfter closing the gap: " << dnmcafSight.losCanSee(1) << " (rays traced: " << dnmcafSight.losTraced() << ")";
 	std::cout << '\n';
 
 	// - iteration using a for loop
@@ -3365,6 +4935,18 @@ int main() {
 	sbrsrcB.Weapon; //what is this, exactly?
 	//answer depends entirely on the type of object we're creating and requirements of our program
 
+	//flyweight version - name and base stats live once in the table, instances only keep their own durability and enchant level
+	flywArchetypeTable flywTable;
+	flywArchetypeId flywIronSword{ flywTable.flywRegister({ "Iron Sword", 41, 1.0f }) };
+	std::vector<flywSword> flywArmory(3, flywCreate(flywTable, flywIronSword));
+	flywArmory[0].EnchantLevel = 5;
+	flywDecayDurabillity(flywArmory, 0.1f);
+	std::cout << "\n" << flywTable.flywGet(flywArmory[0].Archetype).Name
+		<< " damage: " << flywGetDamage(flywTable, flywArmory[0])
+		<< ", durabillity: " << flywArmory[0].Durabillity
+		<< "\nsbrsrcSword size: " << sizeof(sbrsrcSword)
+		<< " bytes, flywSword size: " << sizeof(flywSword) << " bytes";
+
 	// - Sharing Resources
 	shrrSword shrrIronSword;
 	//we have a Player class that carries a Sword, which is stores as a pointer
@@ -3411,6 +4993,18 @@ int main() {
 	//in this case our type contains a std::unique_ptr, which cannot be copied, as such - we get a similar error:
 	//dpcPlayerTwo = dpcPlayerOne; //E1776: function "..." (declared implicitly) cannot be referenced -- it is a deleted function
 
+	//growing a std::vector relocates the existing Players - w noexcept move constructors that's "Moving Player" instead of "Deep copying Sword"
+	std::vector<dpcPlayer> dpcParty;
+	const int dpcCopiesBefore{ dpcPlayer::Copies };
+	const int dpcMovesBefore{ dpcPlayer::Moves };
+	dpcParty.emplace_back();
+	dpcParty.emplace_back(); // Moving Player
+	dpcParty.push_back(dpcPlayerOne); // Deep copying Sword, Deep copying Player, Moving Player x2
+	std::cout << '\n';
+	//only the Player we asked to push_back() got copied, every relocation was a move
+	CHECK(dpcPlayer::Copies - dpcCopiesBefore == 1);
+	CHECK(dpcPlayer::Moves - dpcMovesBefore == 3);
+
 	caoAPlayer caoAPlayerOne;
 	caoAPlayer caoAPlayerTwo;
 	caoAPlayerTwo = caoAPlayerOne;
@@ -3429,6 +5023,24 @@ int main() {
 	rcrsvPartyOne = rcrsvPartyTwo;
 	std::cout << '\n';
 
+	//snapshots skip the Player copy functions entirely, so nothing is logged here
+	snpshHistory<4> rcrsvHistory;
+	rcrsvHistory.snpshPush(rcrsvTakeSnapshot(rcrsvPartyOne));
+	rcrsvPartyOne.rcrsvPlayerOne.Health -= 50;
+	rcrsvRestoreSnapshot(rcrsvPartyOne, rcrsvHistory.snpshGet(0));
+	std::cout << "\nHealth after rollback: "
+		<< rcrsvPartyOne.rcrsvPlayerOne.Health << '\n';
+	//round trip: a restored snapshot has to give back exactly the party it was taken from
+	rcrsvPartyTwo.rcrsvPlayerOne.Health = 42;
+	rcrsvPartyTwo.rcrsvPlayerOne.Level = 7;
+	rcrsvPartyTwo.rcrsvPlayerOne.Experience = 1300;
+	rcrsvHistory.snpshPush(rcrsvTakeSnapshot(rcrsvPartyTwo));
+	rcrsvRestoreSnapshot(rcrsvPartyOne, rcrsvHistory.snpshGet(0));
+	CHECK(rcrsvPartyOne.rcrsvPlayerOne.Health == 42 && rcrsvPartyOne.rcrsvPlayerOne.Level == 7
+		&& rcrsvPartyOne.rcrsvPlayerOne.Experience == 1300);
+	rcrsvRestoreSnapshot(rcrsvPartyOne, rcrsvHistory.snpshGet(1));
+	CHECK(rcrsvPartyOne.rcrsvPlayerOne.Health == 100 && rcrsvPartyOne.rcrsvPlayerOne.Experience == 0);
+
 	prvntcPlayer prvntcPlayerOne;
 	//prvntcPlayer prvntcPlayerTwo{ prvntcPlayerOne }; //E1776: function "..." (declared at line ...) cannot be referenced -- it is a deleted function
 	prvntcPlayer prvntcPlayerThree;
@@ -3446,5 +5058,7 @@ int main() {
 		<< shrptrOne.CurrentQuest.use_count();
 
 
+	//anything CHECK()ed along the way that failed was already reported
+	if (chkFailures()) return 1;
 	return 0; // Function w proclaimed return type should ALWAYS return somithing if else - code is invalid
 }
\ No newline at end of file
@@ -0,0 +1,263 @@
+#include "alogLogger.h"
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class alogRing {
+public:
+	static constexpr std::uint32_t alogCapacity{ 1 << 16 };
+
+	//operator new[] aligns to at least 8, which every record relies on
+	std::unique_ptr<std::byte[]> Buffer{ new std::byte[alogCapacity] };
+	//both only ever grow, positions in the buffer are these modulo alogCapacity
+	std::atomic<std::uint64_t> Write{ 0 };
+	std::atomic<std::uint64_t> Read{ 0 };
+	//producer's copy of Read, so it doesn't have to look at the consumer's cache line on every message
+	std::uint64_t CachedRead{ 0 };
+};
+
+namespace {
+	std::atomic<alogPolicy> alogCurrentPolicy{ alogPolicy::Drop };
+	std::atomic<std::ostream*> alogCurrentSink{ &std::cout };
+	std::atomic<std::uint64_t> alogDropCount{ 0 };
+	//set by the background thread right before it sleeps, producers wake it only then (an idle game costs no wakeups)
+	std::atomic<bool> alogAsleep{ false };
+
+	void alogWakeBackground() {
+		if (alogAsleep.load(std::memory_order_relaxed) && alogAsleep.exchange(false, std::memory_order_acq_rel)) {
+			alogAsleep.notify_one();
+		}
+	}
+
+	void alogAppendSlot(std::string& Out, const std::byte*& Slots) {
+		alogSlot Slot;
+		std::memcpy(&Slot, Slots, sizeof(alogSlot));
+		Slots += sizeof(alogSlot);
+		char Number[32];
+		switch (Slot.Tag) {
+		case alogTag::Int:
+			Out += std::to_string(Slot.Int);
+			break;
+		case alogTag::UInt:
+			Out += std::to_string(Slot.UInt);
+			break;
+		case alogTag::Double:
+			//%g matches what std::cout prints for doubles by default
+			std::snprintf(Number, sizeof(Number), "%g", Slot.Double);
+			Out += Number;
+			break;
+		case alogTag::Bool:
+			Out += Slot.UInt ? "true" : "false";
+			break;
+		case alogTag::Char:
+			Out += static_cast<char>(Slot.Int);
+			break;
+		case alogTag::StaticText:
+			Out.append(Slot.Text, Slot.Length);
+			break;
+		case alogTag::InlineText:
+			Out.append(reinterpret_cast<const char*>(Slots), Slot.Length);
+			Slots += alogAlign(Slot.Length);
+			break;
+		}
+	}
+
+	void alogFormat(std::string& Out, const alogRecordHeader& Header, const std::byte* Slots) {
+		if (Header.Prefix) Out += Header.Prefix;
+		std::uint32_t Used{ 0 };
+		for (const char* Character{ Header.Format }; *Character; ++Character) {
+			if (Character[0] == '{' && Character[1] == '}' && Used < Header.ArgumentCount) {
+				alogAppendSlot(Out, Slots);
+				++Used;
+				++Character;
+			}
+			else {
+				Out += *Character;
+			}
+		}
+	}
+
+	class alogLogger {
+	public:
+		alogLogger() : mThread{ [this] { alogRun(); } } {}
+		~alogLogger() {
+			mStopping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			alogWakeBackground();
+			mThread.join();
+			alogDrain();
+		}
+
+		void alogRegister(std::shared_ptr<alogRing> Ring) {
+			std::lock_guard<std::mutex> Guard{ mRingsLock };
+			mRings.push_back(std::move(Ring));
+		}
+
+		//formats every complete record into one batch, then writes the batch w a single flush
+		void alogDrain() {
+			std::lock_guard<std::mutex> Guard{ mDrainLock };
+			mBatch.clear();
+			alogCollect();
+			alogWriteBatch(true);
+		}
+
+		//same, but the batch ends w one more record that never went through a ring
+		void alogDrainThen(const std::byte* Record) {
+			std::lock_guard<std::mutex> Guard{ mDrainLock };
+			mBatch.clear();
+			alogCollect();
+			alogRecordHeader Header;
+			std::memcpy(&Header, Record, sizeof(Header));
+			alogFormat(mBatch, Header, Record + sizeof(Header));
+			alogWriteBatch(false);
+		}
+
+	private:
+		//formats every complete record in every ring into mBatch (under mDrainLock)
+		void alogCollect() {
+			{
+				std::lock_guard<std::mutex> RingsGuard{ mRingsLock };
+				mDraining = mRings;
+			}
+			for (const std::shared_ptr<alogRing>& Ring : mDraining) {
+				const std::uint64_t Write{ Ring->Write.load(std::memory_order_acquire) };
+				std::uint64_t Read{ Ring->Read.load(std::memory_order_relaxed) };
+				while (Read != Write) {
+					const std::uint32_t Offset{ static_cast<std::uint32_t>(Read % alogRing::alogCapacity) };
+					const std::uint32_t Tail{ alogRing::alogCapacity - Offset };
+					//too little room left for a header - the producer skipped to the start of the buffer
+					if (Tail < sizeof(alogRecordHeader)) {
+						Read += Tail;
+						continue;
+					}
+					alogRecordHeader Header;
+					std::memcpy(&Header, Ring->Buffer.get() + Offset, sizeof(Header));
+					if (Header.Format) {
+						alogFormat(mBatch, Header, Ring->Buffer.get() + Offset + sizeof(Header));
+					}
+					Read += Header.Size;
+				}
+				Ring->Read.store(Read, std::memory_order_release);
+			}
+			mDraining.clear();
+		}
+
+		void alogWriteBatch(bool Flush) {
+			if (mBatch.empty()) return;
+			std::ostream& Sink{ *alogCurrentSink.load(std::memory_order_relaxed) };
+			Sink.write(mBatch.data(), static_cast<std::streamsize>(mBatch.size()));
+			if (Flush) Sink.flush();
+		}
+
+		bool alogAnyPending() {
+			std::lock_guard<std::mutex> Guard{ mRingsLock };
+			for (const std::shared_ptr<alogRing>& Ring : mRings) {
+				if (Ring->Write.load(std::memory_order_relaxed) != Ring->Read.load(std::memory_order_relaxed)) return true;
+			}
+			return false;
+		}
+
+		void alogRun() {
+			while (!mStopping.load(std::memory_order_relaxed)) {
+				alogDrain();
+				//announce the sleep first, then look once more - a producer that committed after our look sees alogAsleep and wakes us
+				//(the fences pair w the one in alogCommit)
+				alogAsleep.store(true, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (alogAnyPending() || mStopping.load(std::memory_order_relaxed)) {
+					alogAsleep.store(false, std::memory_order_relaxed);
+					continue;
+				}
+				alogAsleep.wait(true, std::memory_order_acquire);
+			}
+		}
+
+		std::mutex mRingsLock;
+		std::vector<std::shared_ptr<alogRing>> mRings;
+		std::mutex mDrainLock;
+		std::vector<std::shared_ptr<alogRing>> mDraining;
+		std::string mBatch;
+		std::atomic<bool> mStopping{ false };
+		//last, so everything above exists before the thread starts
+		std::thread mThread;
+	};
+
+	alogLogger& alogGetLogger() {
+		static alogLogger Logger;
+		return Logger;
+	}
+}
+
+void alogSetPolicy(alogPolicy Policy) {
+	alogCurrentPolicy.store(Policy, std::memory_order_relaxed);
+}
+
+void alogSetSink(std::ostream& Sink) {
+	alogFlush();
+	alogCurrentSink.store(&Sink, std::memory_order_relaxed);
+}
+
+void alogFlush() {
+	alogGetLogger().alogDrain();
+}
+
+void alogWriteRecordNow(const std::byte* Record) {
+	alogGetLogger().alogDrainThen(Record);
+}
+
+std::uint64_t alogDropped() {
+	return alogDropCount.load(std::memory_order_relaxed);
+}
+
+//rings are shared w the logger, so messages from threads that already finished still get written
+alogRing& alogGetThreadRing() {
+	thread_local std::shared_ptr<alogRing> Ring{ [] {
+		auto NewRing{ std::make_shared<alogRing>() };
+		alogGetLogger().alogRegister(NewRing);
+		return NewRing;
+	}() };
+	return *Ring;
+}
+
+std::byte* alogBegin(alogRing& Ring, std::uint32_t Size) {
+	if (Size > alogRing::alogCapacity / 2) {
+		alogDropCount.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+	std::uint64_t Write{ Ring.Write.load(std::memory_order_relaxed) };
+	const std::uint32_t Offset{ static_cast<std::uint32_t>(Write % alogRing::alogCapacity) };
+	const std::uint32_t Tail{ alogRing::alogCapacity - Offset };
+	//records are never split, if it doesn't fit before the end of the buffer, the rest of the buffer is skipped
+	const std::uint64_t Needed{ Tail < Size ? Tail + Size : Size };
+
+	while (Write + Needed - Ring.CachedRead > alogRing::alogCapacity) {
+		Ring.CachedRead = Ring.Read.load(std::memory_order_acquire);
+		if (Write + Needed - Ring.CachedRead <= alogRing::alogCapacity) break;
+		if (alogCurrentPolicy.load(std::memory_order_relaxed) == alogPolicy::Drop) {
+			alogDropCount.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		alogWakeBackground();
+		std::this_thread::yield();
+	}
+
+	if (Tail < Size) {
+		if (Tail >= sizeof(alogRecordHeader)) {
+			const alogRecordHeader Padding{ Tail, 0, nullptr, nullptr };
+			std::memcpy(Ring.Buffer.get() + Offset, &Padding, sizeof(Padding));
+		}
+		Write += Tail;
+		Ring.Write.store(Write, std::memory_order_release);
+	}
+	return Ring.Buffer.get() + Write % alogRing::alogCapacity;
+}
+
+void alogCommit(alogRing& Ring, std::uint32_t Size) {
+	Ring.Write.store(Ring.Write.load(std::memory_order_relaxed) + Size, std::memory_order_release);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	alogWakeBackground();
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "intrnSymbol.h"
+
+//asynchronous logger - for logging from code that runs every tick, where waiting on std::cout (or a flush from std::endl) stalls the game
+//the calling thread only copies the format string's address and the raw arguments into its own ring buffer (no formatting, no locks)
+//a background thread formats everything and writes it to the sink in batches
+//
+//	alogWrite("\n{} Taking Damage: {}", mName, Damage);
+//
+//Format must be a string literal (only its address is stored), "{}" is replaced by the next argument
+//supported arguments: integers, floating point, bool, char, strings (copied) and intrnSymbol (not copied - their text lives forever)
+
+//what to do when a thread's ring buffer is full
+enum class alogPolicy {
+	//message is lost, and counted in alogDropped() - the calling thread never waits
+	Drop,
+	//calling thread waits until the background thread has made room - nothing is lost
+	Block
+};
+
+void alogSetPolicy(alogPolicy Policy);
+//where formatted messages go (std::cout by default), the stream has to outlive the logger
+void alogSetSink(std::ostream& Sink);
+//formats and writes everything logged so far, from every thread
+void alogFlush();
+std::uint64_t alogDropped();
+
+// - record encoding (used by alogWrite)
+//a record is a header followed by one tagged 16-byte slot per argument (+ the characters of copied strings)
+enum class alogTag : std::uint32_t {
+	Int,
+	UInt,
+	Double,
+	Bool,
+	Char,
+	//pointer + length to text that outlives the logger (intrnSymbol)
+	StaticText,
+	//characters copied right after the slot
+	InlineText
+};
+
+struct alogRecordHeader {
+	//in bytes, always a multiple of 8, 0 Format marks padding to the end of the ring
+	std::uint32_t Size;
+	std::uint32_t ArgumentCount;
+	const char* Format;
+	//written before the message if not null (eg. the category and level from LOG), must outlive the logger too
+	const char* Prefix;
+};
+
+struct alogSlot {
+	alogTag Tag;
+	std::uint32_t Length;
+	union {
+		std::int64_t Int;
+		std::uint64_t UInt;
+		double Double;
+		const char* Text;
+	};
+};
+
+//single producer (the owning thread), single consumer (the background thread) ring of records
+class alogRing;
+alogRing& alogGetThreadRing();
+//returns where to write Size bytes, or nullptr if the record was dropped
+std::byte* alogBegin(alogRing& Ring, std::uint32_t Size);
+void alogCommit(alogRing& Ring, std::uint32_t Size);
+
+constexpr std::uint32_t alogAlign(std::size_t Size) { return static_cast<std::uint32_t>((Size + 7) & ~std::size_t{ 7 }); }
+
+template <typename T>
+std::uint32_t alogEncodedSize(const T& Argument) {
+	if constexpr (std::is_convertible_v<const T&, std::string_view> && !std::is_same_v<T, intrnSymbol>) {
+		return sizeof(alogSlot) + alogAlign(std::string_view{ Argument }.size());
+	}
+	else {
+		return sizeof(alogSlot);
+	}
+}
+
+template <typename T>
+void alogEncode(std::byte*& Out, const T& Argument) {
+	alogSlot Slot{};
+	std::string_view Copied;
+	if constexpr (std::is_same_v<T, bool>) {
+		Slot.Tag = alogTag::Bool;
+		Slot.UInt = Argument;
+	}
+	else if constexpr (std::is_same_v<T, char>) {
+		Slot.Tag = alogTag::Char;
+		Slot.Int = Argument;
+	}
+	else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+		Slot.Tag = alogTag::Int;
+		Slot.Int = Argument;
+	}
+	else if constexpr (std::is_integral_v<T>) {
+		Slot.Tag = alogTag::UInt;
+		Slot.UInt = Argument;
+	}
+	else if constexpr (std::is_floating_point_v<T>) {
+		Slot.Tag = alogTag::Double;
+		Slot.Double = Argument;
+	}
+	else if constexpr (std::is_same_v<T, intrnSymbol>) {
+		const std::string_view Text{ Argument.intrnView() };
+		Slot.Tag = alogTag::StaticText;
+		Slot.Length = static_cast<std::uint32_t>(Text.size());
+		Slot.Text = Text.data();
+	}
+	else {
+		static_assert(std::is_convertible_v<const T&, std::string_view>, "alogWrite doesn't know how to store this argument type");
+		Copied = Argument;
+		Slot.Tag = alogTag::InlineText;
+		Slot.Length = static_cast<std::uint32_t>(Copied.size());
+	}
+	std::memcpy(Out, &Slot, sizeof(alogSlot));
+	Out += sizeof(alogSlot);
+	if (!Copied.empty()) {
+		std::memcpy(Out, Copied.data(), Copied.size());
+		Out += alogAlign(Copied.size());
+	}
+}
+
+template <typename... Arguments>
+void alogWritePrefixed(const char* Prefix, const char* Format, const Arguments&... Values) {
+	const std::uint32_t Size{ static_cast<std::uint32_t>(sizeof(alogRecordHeader)) + (0 + ... + alogEncodedSize(Values)) };
+	alogRing& Ring{ alogGetThreadRing() };
+	std::byte* Out{ alogBegin(Ring, Size) };
+	if (!Out) return;
+	const alogRecordHeader Header{ Size, static_cast<std::uint32_t>(sizeof...(Values)), Format, Prefix };
+	std::memcpy(Out, &Header, sizeof(Header));
+	Out += sizeof(Header);
+	(alogEncode(Out, Values), ...);
+	alogCommit(Ring, Size);
+}
+
+template <typename... Arguments>
+void alogWrite(const char* Format, const Arguments&... Values) {
+	alogWritePrefixed(nullptr, Format, Values...);
+}
+
+// - writing right away
+//for messages that are part of the program's output, and have to stay in order w what's written to std::cout directly
+//the record is formatted on the calling thread and written after everything logged before it (w/out a flush, like std::cout)
+void alogWriteRecordNow(const std::byte* Record);
+
+template <typename... Arguments>
+void alogWritePrefixedNow(const char* Prefix, const char* Format, const Arguments&... Values) {
+	const std::uint32_t Size{ static_cast<std::uint32_t>(sizeof(alogRecordHeader)) + (0 + ... + alogEncodedSize(Values)) };
+	std::vector<std::byte> Record(Size);
+	std::byte* Out{ Record.data() };
+	const alogRecordHeader Header{ Size, static_cast<std::uint32_t>(sizeof...(Values)), Format, Prefix };
+	std::memcpy(Out, &Header, sizeof(Header));
+	Out += sizeof(Header);
+	(alogEncode(Out, Values), ...);
+	alogWriteRecordNow(Record.data());
+}
+
+template <typename... Arguments>
+void alogWriteNow(const char* Format, const Arguments&... Values) {
+	alogWritePrefixedNow(nullptr, Format, Values...);
+}
@@ -0,0 +1,187 @@
+#include "bhvrBehaviorTree.h"
+#include <cassert>
+
+void bhvrLibrary::bhvrRegister(std::string Name, bhvrLeafFunction Function) {
+	assert(bhvrFind(Name) == -1);
+	mNames.push_back(std::move(Name));
+	mFunctions.push_back(std::move(Function));
+}
+
+int bhvrLibrary::bhvrFind(std::string_view Name) const {
+	for (int Leaf{ 0 }; Leaf < static_cast<int>(mNames.size()); ++Leaf) {
+		if (mNames[Leaf] == Name) return Leaf;
+	}
+	return -1;
+}
+
+namespace {
+	bool bhvrIsSpace(char Character) { return Character == ' ' || Character == '\t' || Character == '\r'; }
+
+	std::string_view bhvrNextWord(std::string_view& Line) {
+		while (!Line.empty() && bhvrIsSpace(Line.front())) Line.remove_prefix(1);
+		std::size_t Length{ 0 };
+		while (Length < Line.size() && !bhvrIsSpace(Line[Length])) ++Length;
+		const std::string_view Word{ Line.substr(0, Length) };
+		Line.remove_prefix(Length);
+		return Word;
+	}
+}
+
+bool bhvrTree::bhvrCompile(std::string_view Text, const bhvrLibrary& Library, std::string& Error) {
+	const auto Reset{ [this] {
+		mKinds.clear();
+		mParents.clear();
+		mNextSiblings.clear();
+		mFirstLeaves.clear();
+		mLeaves.clear();
+	} };
+	//a tree that failed to compile is left empty
+	const auto Fail{ [&](std::string Message) {
+		Reset();
+		Error = std::move(Message);
+		return false;
+	} };
+	Reset();
+
+	struct bhvrOpen {
+		int Indent;
+		bhvrNode Node;
+	};
+	//composites that can still get children, innermost last
+	std::vector<bhvrOpen> Open;
+	//only needed while compiling, to link up siblings
+	std::vector<bhvrNode> LastChildren;
+	int LineNumber{ 0 };
+	int LastIndent{ 0 };
+
+	while (!Text.empty()) {
+		const std::size_t End{ Text.find('\n') };
+		std::string_view Line{ Text.substr(0, End) };
+		Text.remove_prefix(End == std::string_view::npos ? Text.size() : End + 1);
+		++LineNumber;
+
+		//tabs count as 4 spaces
+		int Indent{ 0 };
+		while (!Line.empty() && bhvrIsSpace(Line.front())) {
+			Indent += Line.front() == '\t' ? 4 : 1;
+			Line.remove_prefix(1);
+		}
+		const std::string_view Keyword{ bhvrNextWord(Line) };
+		if (Keyword.empty() || Keyword.front() == '#') continue;
+		const std::string_view Name{ bhvrNextWord(Line) };
+		const std::string Where{ "line " + std::to_string(LineNumber) + ": " };
+
+		bhvrKind Kind;
+		if (Keyword == "selector") Kind = bhvrKind::Selector;
+		else if (Keyword == "sequence") Kind = bhvrKind::Sequence;
+		else if (Keyword == "condition") Kind = bhvrKind::Condition;
+		else if (Keyword == "action") Kind = bhvrKind::Action;
+		else {
+			return Fail(Where + "unknown node '" + std::string{ Keyword } + "'");
+		}
+		const bool IsLeaf{ Kind == bhvrKind::Condition || Kind == bhvrKind::Action };
+
+		int Leaf{ -1 };
+		if (IsLeaf) {
+			Leaf = Library.bhvrFind(Name);
+			if (Leaf == -1) {
+				return Fail(Where + "no leaf named '" + std::string{ Name } + "'");
+			}
+		}
+		if ((IsLeaf ? bhvrNextWord(Line) : Name).size() != 0) {
+			return Fail(Where + "unexpected text after '" + std::string{ Keyword } + "'");
+		}
+
+		if (!mKinds.empty() && Indent > LastIndent && mLeaves.back() != -1) {
+			return Fail(Where + "only selector and sequence can have children");
+		}
+		LastIndent = Indent;
+		//anything not indented deeper than an open composite isn't its child
+		while (!Open.empty() && Open.back().Indent >= Indent) Open.pop_back();
+		if (Open.empty() && !mKinds.empty()) {
+			return Fail(Where + "a tree can only have one root");
+		}
+		if (mKinds.size() >= bhvrNone) {
+			return Fail(Where + "too many nodes");
+		}
+
+		const bhvrNode Node{ static_cast<bhvrNode>(mKinds.size()) };
+		const bhvrNode Parent{ Open.empty() ? bhvrNone : Open.back().Node };
+		mKinds.push_back(Kind);
+		mParents.push_back(Parent);
+		mNextSiblings.push_back(bhvrNone);
+		mLeaves.push_back(Leaf);
+		LastChildren.push_back(bhvrNone);
+		if (Parent != bhvrNone) {
+			if (LastChildren[Parent] != bhvrNone) mNextSiblings[LastChildren[Parent]] = Node;
+			LastChildren[Parent] = Node;
+		}
+		if (!IsLeaf) Open.push_back({ Indent, Node });
+	}
+
+	if (mKinds.empty()) {
+		return Fail("the tree is empty");
+	}
+
+	//a composite's first child is the node right after it, so this fills in from the back
+	mFirstLeaves.resize(mKinds.size());
+	for (int Node{ bhvrSize() - 1 }; Node >= 0; --Node) {
+		if (mLeaves[Node] != -1) {
+			mFirstLeaves[Node] = static_cast<bhvrNode>(Node);
+		}
+		else if (LastChildren[Node] == bhvrNone) {
+			return Fail(std::string{ mKinds[Node] == bhvrKind::Selector ? "a selector" : "a sequence" } + " has no children");
+		}
+		else {
+			mFirstLeaves[Node] = mFirstLeaves[Node + 1];
+		}
+	}
+	return true;
+}
+
+bhvrRunner::bhvrRunner(const bhvrTree& Tree, const bhvrLibrary& Library, int EntityCount)
+	: mTree{ Tree }, mLibrary{ Library }, mCursors(EntityCount, bhvrNone), mWaiting(Tree.bhvrSize()) {
+	assert(Tree.bhvrSize() > 0);
+}
+
+void bhvrRunner::bhvrTick() {
+	const bhvrNode Start{ mTree.bhvrFirstLeaf(0) };
+	for (std::uint32_t Entity{ 0 }; Entity < mCursors.size(); ++Entity) {
+		mWaiting[mCursors[Entity] == bhvrNone ? Start : mCursors[Entity]].push_back(Entity);
+	}
+
+	for (int Index{ 0 }; Index < mTree.bhvrSize(); ++Index) {
+		const bhvrNode Node{ static_cast<bhvrNode>(Index) };
+		std::vector<std::uint32_t>& Batch{ mWaiting[Node] };
+		if (Batch.empty()) continue;
+
+		const int Count{ static_cast<int>(Batch.size()) };
+		mResults.resize(Count);
+		mLibrary.bhvrGet(mTree.bhvrGetLeaf(Node))(Batch.data(), Count, mResults.data());
+		const bool IsCondition{ mTree.bhvrGetKind(Node) == bhvrKind::Condition };
+		for (int Slot{ 0 }; Slot < Count; ++Slot) {
+			//a condition can't be in progress
+			const bhvrStatus Status{ IsCondition && mResults[Slot] == bhvrStatus::Running ? bhvrStatus::Failure : mResults[Slot] };
+			bhvrContinue(Batch[Slot], Node, Status);
+		}
+		Batch.clear();
+	}
+	mEntityTicks += mCursors.size();
+}
+
+void bhvrRunner::bhvrContinue(std::uint32_t Entity, bhvrNode Node, bhvrStatus Status) {
+	if (Status == bhvrStatus::Running) {
+		mCursors[Entity] = Node;
+		return;
+	}
+	mCursors[Entity] = bhvrNone;
+	for (bhvrNode Parent{ mTree.bhvrGetParent(Node) }; Parent != bhvrNone; Node = Parent, Parent = mTree.bhvrGetParent(Node)) {
+		//a sequence moves on after a success, a selector after a failure - otherwise the parent finishes w the same result
+		const bool MoveOn{ mTree.bhvrGetKind(Parent) == bhvrKind::Sequence ? Status == bhvrStatus::Success : Status == bhvrStatus::Failure };
+		const bhvrNode Sibling{ mTree.bhvrGetNextSibling(Node) };
+		if (MoveOn && Sibling != bhvrNone) {
+			mWaiting[mTree.bhvrFirstLeaf(Sibling)].push_back(Entity);
+			return;
+		}
+	}
+}
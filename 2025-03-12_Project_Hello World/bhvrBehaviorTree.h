@@ -0,0 +1,105 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//behavior trees for designer-authored AI (Goblin, Dragon, Healer, ...), written in a simple indented text format:
+//
+//	selector
+//		sequence
+//			condition IsDead
+//			action DropLoot
+//		action Attack
+//
+// - selector: runs its children in order until one succeeds
+// - sequence: runs its children in order until one fails
+// - condition / action: leaves, implemented in C++ and registered by name in a bhvrLibrary
+//blank lines and lines starting w # are ignored, children are indented deeper than their parent (spaces or tabs)
+//
+//a tree is compiled into flat arrays of nodes in depth-first order, so walking it is index arithmetic rather than pointer chasing
+//each entity only stores the index of the node it's at
+//entities waiting at the same leaf are handed to that leaf's function together, as one batch
+
+enum class bhvrStatus : std::uint8_t {
+	Success,
+	Failure,
+	//the action isn't finished - the entity resumes at this leaf next tick
+	Running
+};
+
+//leaf functions get a batch of entity indices, and write one result for each
+using bhvrLeafFunction = std::function<void(const std::uint32_t* Entities, int Count, bhvrStatus* Results)>;
+
+class bhvrLibrary {
+public:
+	void bhvrRegister(std::string Name, bhvrLeafFunction Function);
+	//-1 if there is no leaf w that name
+	int bhvrFind(std::string_view Name) const;
+	const bhvrLeafFunction& bhvrGet(int Leaf) const { return mFunctions[Leaf]; }
+
+private:
+	std::vector<std::string> mNames;
+	std::vector<bhvrLeafFunction> mFunctions;
+};
+
+enum class bhvrKind : std::uint8_t {
+	Selector,
+	Sequence,
+	Condition,
+	Action
+};
+
+using bhvrNode = std::uint16_t;
+constexpr bhvrNode bhvrNone{ 0xFFFF };
+
+class bhvrTree {
+public:
+	//returns false (w a message in Error) if the text isn't a valid tree, or uses a leaf the library doesn't have
+	bool bhvrCompile(std::string_view Text, const bhvrLibrary& Library, std::string& Error);
+
+	int bhvrSize() const { return static_cast<int>(mKinds.size()); }
+	bhvrKind bhvrGetKind(bhvrNode Node) const { return mKinds[Node]; }
+	bhvrNode bhvrGetParent(bhvrNode Node) const { return mParents[Node]; }
+	bhvrNode bhvrGetNextSibling(bhvrNode Node) const { return mNextSiblings[Node]; }
+	int bhvrGetLeaf(bhvrNode Node) const { return mLeaves[Node]; }
+	//the first leaf reached by entering Node (children always directly follow their parent)
+	bhvrNode bhvrFirstLeaf(bhvrNode Node) const { return mFirstLeaves[Node]; }
+
+private:
+	//one array per field, all indexed by node
+	std::vector<bhvrKind> mKinds;
+	std::vector<bhvrNode> mParents;
+	std::vector<bhvrNode> mNextSiblings;
+	std::vector<bhvrNode> mFirstLeaves;
+	std::vector<int> mLeaves;
+};
+
+//runs one tree for a group of entities (0 .. Count - 1)
+class bhvrRunner {
+public:
+	bhvrRunner(const bhvrTree& Tree, const bhvrLibrary& Library, int EntityCount);
+
+	//one tick for every entity
+	//nodes are visited once, in depth-first order - an entity only ever moves to later nodes within a tick,
+	//so by the time a leaf is reached, every entity that will arrive at it this tick is already waiting there
+	void bhvrTick();
+
+	//leaf the entity is currently running (bhvrNone if it isn't in the middle of anything)
+	bhvrNode bhvrGetRunning(int Entity) const { return mCursors[Entity]; }
+	std::uint64_t bhvrEntityTicks() const { return mEntityTicks; }
+
+private:
+	//passes a leaf's result up the tree, until the entity reaches its next leaf (queued) or finishes the tick
+	void bhvrContinue(std::uint32_t Entity, bhvrNode Node, bhvrStatus Status);
+
+	const bhvrTree& mTree;
+	const bhvrLibrary& mLibrary;
+	//leaf each entity resumes at next tick, bhvrNone to start over from the root
+	std::vector<bhvrNode> mCursors;
+	//entities waiting at each leaf in the current tick
+	std::vector<std::vector<std::uint32_t>> mWaiting;
+	std::vector<bhvrStatus> mResults;
+	std::uint64_t mEntityTicks{ 0 };
+};
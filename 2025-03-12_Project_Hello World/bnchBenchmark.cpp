@@ -0,0 +1,164 @@
+#include "bnchBenchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <thread>
+#include <utility>
+
+namespace {
+	using bnchClock = std::chrono::steady_clock;
+
+	std::vector<std::pair<std::string, bnchCase>>& bnchCases() {
+		static std::vector<std::pair<std::string, bnchCase>> Cases;
+		return Cases;
+	}
+
+	double bnchTimeMs(const bnchCase& Case, std::uint64_t Iterations) {
+		const bnchClock::time_point Start{ bnchClock::now() };
+		Case(Iterations);
+		return std::chrono::duration<double, std::milli>(bnchClock::now() - Start).count();
+	}
+
+	//iterations for one repetition, found while warming up
+	std::uint64_t bnchCalibrate(const bnchCase& Case, const bnchOptions& Options) {
+		std::uint64_t Iterations{ 1 };
+		double WarmupLeft{ Options.WarmupMs };
+		while (true) {
+			const double Ms{ bnchTimeMs(Case, Iterations) };
+			WarmupLeft -= Ms;
+			if (Ms >= Options.MinRepetitionMs) {
+				if (WarmupLeft <= 0.0) return Iterations;
+				continue;
+			}
+			//aim a bit past the target, but grow at most 10x at a time (the first runs are the noisiest)
+			const double Scale{ Ms > 0.0 ? Options.MinRepetitionMs * 1.2 / Ms : 10.0 };
+			Iterations = static_cast<std::uint64_t>(static_cast<double>(Iterations) * std::clamp(Scale, 2.0, 10.0));
+		}
+	}
+
+	void bnchWriteString(std::ostream& Out, const std::string& Text) {
+		Out << '"';
+		for (char Character : Text) {
+			if (Character == '"' || Character == '\\') Out << '\\';
+			Out << Character;
+		}
+		Out << '"';
+	}
+
+	//what the case that is running right now reported
+	double bnchItems{ 0.0 };
+	std::vector<std::pair<std::string, double>> bnchCounters;
+
+	//the sink has to be volatile, otherwise the store (and so the use of the pointer) could be removed
+	const void* volatile bnchSink{ nullptr };
+}
+
+void bnchRegister(std::string Name, bnchCase Case) {
+	bnchCases().emplace_back(std::move(Name), std::move(Case));
+}
+
+void bnchClear() {
+	bnchCases().clear();
+}
+
+void bnchSetItemsPerIteration(double Items) {
+	bnchItems = Items;
+}
+
+void bnchSetCounter(std::string Name, double Value) {
+	for (auto& [Existing, Current] : bnchCounters) {
+		if (Existing == Name) {
+			Current = Value;
+			return;
+		}
+	}
+	bnchCounters.emplace_back(std::move(Name), Value);
+}
+
+void bnchEscape(const void* Pointer) {
+	bnchSink = Pointer;
+}
+
+std::vector<bnchResult> bnchRunAll(const bnchOptions& Options) {
+	std::vector<bnchResult> Results;
+	const int Repetitions{ std::max(1, Options.Repetitions) };
+	std::vector<double> Samples(Repetitions);
+	for (const auto& [Name, Case] : bnchCases()) {
+		bnchItems = 0.0;
+		bnchCounters.clear();
+		const std::uint64_t Iterations{ bnchCalibrate(Case, Options) };
+		for (double& Sample : Samples) Sample = bnchTimeMs(Case, Iterations) * 1e6 / static_cast<double>(Iterations);
+
+		std::sort(Samples.begin(), Samples.end());
+		const std::size_t Count{ Samples.size() };
+		double Sum{ 0.0 };
+		for (double Sample : Samples) Sum += Sample;
+		const double Mean{ Sum / Count };
+		double SquaredDeviations{ 0.0 };
+		for (double Sample : Samples) SquaredDeviations += (Sample - Mean) * (Sample - Mean);
+
+		const double Median{ Count % 2 ? Samples[Count / 2] : (Samples[Count / 2 - 1] + Samples[Count / 2]) / 2.0 };
+		Results.push_back({ Name, Iterations, Repetitions,
+			Samples.front(),
+			Median,
+			Mean,
+			Count > 1 ? std::sqrt(SquaredDeviations / (Count - 1)) : 0.0,
+			Samples.back(),
+			Median > 0.0 ? bnchItems * 1e9 / Median : 0.0,
+			bnchCounters });
+	}
+	return Results;
+}
+
+void bnchPrint(std::ostream& Out, const std::vector<bnchResult>& Results) {
+	std::size_t NameWidth{ 4 };
+	for (const bnchResult& Result : Results) NameWidth = std::max(NameWidth, Result.Name.size());
+	const std::ios::fmtflags Flags{ Out.flags() };
+	const std::streamsize Precision{ Out.precision() };
+	Out << std::fixed << std::setprecision(2);
+	Out << '\n' << std::left << std::setw(NameWidth) << "Case" << std::right
+		<< std::setw(12) << "median ns" << std::setw(12) << "min ns" << std::setw(12) << "stddev ns" << std::setw(14) << "iterations"
+		<< std::setw(14) << "items/s";
+	for (const bnchResult& Result : Results) {
+		Out << '\n' << std::left << std::setw(NameWidth) << Result.Name << std::right
+			<< std::setw(12) << Result.MedianNs << std::setw(12) << Result.MinNs << std::setw(12) << Result.StdDevNs
+			<< std::setw(14) << Result.Iterations;
+		if (Result.ItemsPerSecond > 0.0) Out << std::setw(14) << std::setprecision(0) << Result.ItemsPerSecond << std::setprecision(2);
+		for (const auto& [Name, Value] : Result.Counters) Out << "  " << Name << '=' << Value;
+	}
+	Out << '\n';
+	Out.flags(Flags);
+	Out.precision(Precision);
+}
+
+void bnchWriteJson(std::ostream& Out, const std::vector<bnchResult>& Results) {
+	const std::streamsize Precision{ Out.precision() };
+	Out << std::setprecision(6);
+	Out << "{\n  \"context\": { \"hardware_threads\": " << std::thread::hardware_concurrency() << " },\n  \"benchmarks\": [";
+	for (std::size_t Index{ 0 }; Index < Results.size(); ++Index) {
+		const bnchResult& Result{ Results[Index] };
+		Out << (Index ? ",\n" : "\n") << "    { \"name\": ";
+		bnchWriteString(Out, Result.Name);
+		Out << ", \"iterations\": " << Result.Iterations
+			<< ", \"repetitions\": " << Result.Repetitions
+			<< ", \"min_ns\": " << Result.MinNs
+			<< ", \"median_ns\": " << Result.MedianNs
+			<< ", \"mean_ns\": " << Result.MeanNs
+			<< ", \"stddev_ns\": " << Result.StdDevNs
+			<< ", \"max_ns\": " << Result.MaxNs;
+		if (Result.ItemsPerSecond > 0.0) Out << ", \"items_per_second\": " << Result.ItemsPerSecond;
+		if (!Result.Counters.empty()) {
+			Out << ", \"counters\": {";
+			for (std::size_t Counter{ 0 }; Counter < Result.Counters.size(); ++Counter) {
+				Out << (Counter ? ", " : " ");
+				bnchWriteString(Out, Result.Counters[Counter].first);
+				Out << ": " << Result.Counters[Counter].second;
+			}
+			Out << " }";
+		}
+		Out << " }";
+	}
+	Out << "\n  ]\n}\n";
+	Out.precision(Precision);
+}
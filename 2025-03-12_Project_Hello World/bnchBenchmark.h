@@ -0,0 +1,90 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+//microbenchmarks, for putting numbers behind the performance claims in the comments
+//a case gets an iteration count and runs the code being measured that many times:
+//
+//	bnchRegister("thisVector3 prefix ++", [](std::uint64_t Iterations) {
+//		thisVector3 Vector{};
+//		for (std::uint64_t i{ 0 }; i < Iterations; ++i) bnchDoNotOptimize(++Vector);
+//	});
+//	bnchPrint(std::cout, bnchRunAll());
+//
+//every case is warmed up first (which also picks an iteration count, so one repetition takes at least MinRepetitionMs),
+//then timed over several repetitions - results are per iteration, summarized over the repetitions
+
+using bnchCase = std::function<void(std::uint64_t Iterations)>;
+void bnchRegister(std::string Name, bnchCase Case);
+//forgets every registered case, and destroys whatever their functions captured
+//(eg. state that has to be gone before thread_local allocators it came from, at the end of main())
+void bnchClear();
+
+// - called from inside a case, while it runs (the last value wins)
+//when one iteration processes many items (rays, resumes, ...) - the result then also has items per second
+void bnchSetItemsPerIteration(double Items);
+//any other number worth reporting next to the timings (eg. bytes per object)
+void bnchSetCounter(std::string Name, double Value);
+
+struct bnchOptions {
+	double WarmupMs{ 100.0 };
+	double MinRepetitionMs{ 20.0 };
+	//at least 1 is always run
+	int Repetitions{ 15 };
+};
+
+//nanoseconds per iteration
+struct bnchResult {
+	std::string Name;
+	std::uint64_t Iterations;
+	int Repetitions;
+	double MinNs;
+	double MedianNs;
+	double MeanNs;
+	double StdDevNs;
+	double MaxNs;
+	//0 if the case didn't set its items per iteration, otherwise based on the median
+	double ItemsPerSecond;
+	std::vector<std::pair<std::string, double>> Counters;
+};
+
+//runs every registered case, in the order they were registered
+std::vector<bnchResult> bnchRunAll(const bnchOptions& Options = {});
+//human readable table
+void bnchPrint(std::ostream& Out, const std::vector<bnchResult>& Results);
+//{ "context": {...}, "benchmarks": [ { "name": ..., "median_ns": ..., "counters": {...} } ] }, for comparing runs w tools
+void bnchWriteJson(std::ostream& Out, const std::vector<bnchResult>& Results);
+
+// - keeping the measured code alive
+//the optimizer removes work whose result is never used, and precomputes work on values it can see through
+void bnchEscape(const void* Pointer);
+
+//Value counts as used
+template <typename T>
+void bnchDoNotOptimize(const T& Value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(Value) : "memory");
+#else
+	bnchEscape(&Value);
+	_ReadWriteBarrier();
+#endif
+}
+
+//Value counts as used, and as possibly changed afterwards (eg. so a pointer's target type can't be assumed)
+template <typename T>
+void bnchDoNotOptimize(T& Value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : "+r,m"(Value) : : "memory");
+#else
+	bnchEscape(&Value);
+	_ReadWriteBarrier();
+#endif
+}
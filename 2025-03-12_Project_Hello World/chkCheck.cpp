@@ -0,0 +1,126 @@
+#include "chkCheck.h"
+#include "nmthNumberTheory.h"
+#include "strtSaturate.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace {
+	int chkFailed{ 0 };
+
+	// - nmthNumberTheory.h
+	void chkNumberTheory() {
+		std::uint32_t Divisors[nmthMaxDivisors32];
+		//the most divisors any 32-bit number has, and the most any int has
+		CHECK(nmthDivisors(3491888400u, Divisors, nmthMaxDivisors32) == 1920);
+		if (CHECK(nmthDivisors(2095133040u, Divisors, nmthMaxDivisors32) == 1600)) {
+			std::sort(Divisors, Divisors + 1600);
+			CHECK(std::adjacent_find(Divisors, Divisors + 1600) == Divisors + 1600);
+			CHECK(std::all_of(Divisors, Divisors + 1600, [](std::uint32_t Divisor) { return 2095133040u % Divisor == 0; }));
+			CHECK(Divisors[0] == 1 && Divisors[1599] == 2095133040u);
+		}
+		//too many for the buffer - the count still comes back, and nothing is written
+		Divisors[0] = 0;
+		CHECK(nmthDivisors(2095133040u, Divisors, 1599) == 1600);
+		CHECK(Divisors[0] == 0);
+	}
+
+	// - strtSaturate.h
+	//columns of every length 0..20 (so through the SSE2 lanes and the scalar tail after them), w every edge value in every lane,
+	//against every edge amount and a few clamp ranges - returns how many results differ from doing the same in 64 bits
+	//(the value right after the column has to stay untouched too)
+	template <typename T, typename Kernel>
+	int chkSaturateMismatches(const std::vector<T>& Edges, bool SameAmount, std::int64_t (*Operation)(std::int64_t, std::int64_t), Kernel Run) {
+		const T Lowest{ std::numeric_limits<T>::min() };
+		const T Highest{ std::numeric_limits<T>::max() };
+		const T Ranges[][2]{ { Lowest, Highest }, { 0, Highest }, { T(-100), T(100) }, { T(5), T(5) } };
+		const std::size_t EdgeCount{ Edges.size() };
+		int Mismatches{ 0 };
+		for (int Count{ 0 }; Count <= 20; ++Count) {
+			for (std::size_t Start{ 0 }; Start < EdgeCount; ++Start) {
+				for (std::size_t Shift{ 0 }; Shift < EdgeCount; ++Shift) {
+					for (const auto& Range : Ranges) {
+						std::vector<T> Values(Count + 1, T(77));
+						std::vector<T> Amounts(Count + 1);
+						for (int i{ 0 }; i <= Count; ++i) Amounts[i] = Edges[(Shift + (SameAmount ? 0 : Start + i)) % EdgeCount];
+						for (int i{ 0 }; i < Count; ++i) Values[i] = Edges[(Start + i) % EdgeCount];
+						const std::vector<T> Before{ Values };
+						Run(Values.data(), Amounts.data(), Count, Range[0], Range[1]);
+						for (int i{ 0 }; i < Count; ++i) {
+							const std::int64_t Expected{ std::clamp<std::int64_t>(Operation(Before[i], Amounts[i]), Range[0], Range[1]) };
+							if (Values[i] != Expected) ++Mismatches;
+						}
+						if (Values[Count] != T(77)) ++Mismatches;
+					}
+				}
+			}
+		}
+		return Mismatches;
+	}
+
+	std::int64_t chkAdd(std::int64_t A, std::int64_t B) { return A + B; }
+	std::int64_t chkSub(std::int64_t A, std::int64_t B) { return A - B; }
+	std::int64_t chkMul(std::int64_t A, std::int64_t B) { return A * B; }
+
+	void chkSaturate() {
+		using std::int16_t;
+		using std::int32_t;
+		//the limits, around them, mixed signs, and where products start to overflow (181^2 and 46341^2 just do)
+		const std::vector<int16_t> Edges16{ INT16_MIN, INT16_MIN + 1, -16384, -181, -2, -1, 0, 1, 2, 181, 16384, INT16_MAX - 1, INT16_MAX };
+		const std::vector<int32_t> Edges32{ INT32_MIN, INT32_MIN + 1, -1'073'741'824, -46341, -65536, -2, -1, 0, 1, 2, 65536, 46341,
+			1'073'741'824, INT32_MAX - 1, INT32_MAX };
+
+		CHECK(chkSaturateMismatches(Edges16, true, chkAdd, [](int16_t* Values, const int16_t* Amounts, int Count, int16_t Min, int16_t Max) {
+			strtAddClamp(Values, Count, Amounts[0], Min, Max);
+		}) == 0);
+		CHECK(chkSaturateMismatches(Edges16, true, chkSub, [](int16_t* Values, const int16_t* Amounts, int Count, int16_t Min, int16_t Max) {
+			strtSubClamp(Values, Count, Amounts[0], Min, Max);
+		}) == 0);
+		CHECK(chkSaturateMismatches(Edges16, true, chkMul, [](int16_t* Values, const int16_t* Amounts, int Count, int16_t Min, int16_t Max) {
+			strtMulClamp(Values, Count, Amounts[0], Min, Max);
+		}) == 0);
+		CHECK(chkSaturateMismatches(Edges32, true, chkAdd, [](int32_t* Values, const int32_t* Amounts, int Count, int32_t Min, int32_t Max) {
+			strtAddClamp(Values, Count, Amounts[0], Min, Max);
+		}) == 0);
+		CHECK(chkSaturateMismatches(Edges32, true, chkSub, [](int32_t* Values, const int32_t* Amounts, int Count, int32_t Min, int32_t Max) {
+			strtSubClamp(Values, Count, Amounts[0], Min, Max);
+		}) == 0);
+		CHECK(chkSaturateMismatches(Edges32, true, chkMul, [](int32_t* Values, const int32_t* Amounts, int Count, int32_t Min, int32_t Max) {
+			strtMulClamp(Values, Count, Amounts[0], Min, Max);
+		}) == 0);
+
+		CHECK(chkSaturateMismatches(Edges16, false, chkAdd, [](int16_t* Values, const int16_t* Amounts, int Count, int16_t Min, int16_t Max) {
+			strtAddClamp(Values, Amounts, Count, Min, Max);
+		}) == 0);
+		CHECK(chkSaturateMismatches(Edges16, false, chkSub, [](int16_t* Values, const int16_t* Amounts, int Count, int16_t Min, int16_t Max) {
+			strtSubClamp(Values, Amounts, Count, Min, Max);
+		}) == 0);
+		CHECK(chkSaturateMismatches(Edges32, false, chkAdd, [](int32_t* Values, const int32_t* Amounts, int Count, int32_t Min, int32_t Max) {
+			strtAddClamp(Values, Amounts, Count, Min, Max);
+		}) == 0);
+		CHECK(chkSaturateMismatches(Edges32, false, chkSub, [](int32_t* Values, const int32_t* Amounts, int Count, int32_t Min, int32_t Max) {
+			strtSubClamp(Values, Amounts, Count, Min, Max);
+		}) == 0);
+	}
+}
+
+bool chkReport(bool Passed, const char* Condition, const char* File, int Line) {
+	if (!Passed) {
+		++chkFailed;
+		std::cerr << File << '(' << Line << "): check failed: " << Condition << '\n';
+	}
+	return Passed;
+}
+
+int chkFailures() {
+	return chkFailed;
+}
+
+int chkRunModuleChecks() {
+	const int FailedBefore{ chkFailed };
+	chkNumberTheory();
+	chkSaturate();
+	return chkFailed - FailedBefore;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+//checks that stay in every configuration - assert() is removed by NDEBUG, so the Release and Benchmark builds would skip it
+//a failed check prints what failed and where, and is counted, so main() can return non-zero:
+//
+//	CHECK(Party.size() == 3);
+//	return chkFailures() ? 1 : 0;
+
+//returns Passed, so a check can also guard the code after it
+bool chkReport(bool Passed, const char* Condition, const char* File, int Line);
+int chkFailures();
+
+#define CHECK(Condition) chkReport(static_cast<bool>(Condition), #Condition, __FILE__, __LINE__)
+
+//the modules checked on their own (edge cases, and against simple reference versions)
+//returns the number of checks that failed
+int chkRunModuleChecks();
@@ -0,0 +1,109 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include "alogLogger.h"
+
+//categorized logging, along the lines of Unreal's UE_LOG(LogTemp, Error, TEXT("Hello!"))
+//
+//	LOG_CATEGORY(LogCombat, Log, Verbose, Deferred);
+//	LOG(LogCombat, Warning, "{} is low on health: {}", Name, Health);
+//
+//every category has two minimum levels:
+// - compile time: anything below it is removed by the compiler - no code, and the arguments aren't even evaluated
+// - run time: can be changed while running (clgSetLevel), costs one relaxed atomic load per call that survived compilation
+//messages are prefixed w "[Category] Level: ", and every category picks where they go (clgOutput)
+
+enum class clgLevel : std::uint8_t {
+	VeryVerbose,
+	Verbose,
+	Log,
+	Display,
+	Warning,
+	Error,
+	//nothing is logged at this level, it's only used as a minimum to turn a category off
+	Off
+};
+
+enum class clgOutput : std::uint8_t {
+	//formatted and written on the calling thread - stays in order w what's written to std::cout directly (the program's own output)
+	Immediate,
+	//through the asynchronous logger's ring (see alogLogger.h) - the caller doesn't wait on std::cout, but the text shows up later
+	//(for diagnostics from code that runs every tick)
+	Deferred
+};
+
+//every category's compile time minimum is raised to at least this, eg. to strip all Verbose logs from shipping builds
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL VeryVerbose
+#endif
+
+constexpr const char* clgLevelName(clgLevel Level) {
+	switch (Level) {
+	case clgLevel::VeryVerbose: return "VeryVerbose";
+	case clgLevel::Verbose: return "Verbose";
+	case clgLevel::Log: return "Log";
+	case clgLevel::Display: return "Display";
+	case clgLevel::Warning: return "Warning";
+	case clgLevel::Error: return "Error";
+	default: return "Off";
+	}
+}
+
+constexpr clgLevel clgMax(clgLevel A, clgLevel B) { return A < B ? B : A; }
+
+constexpr std::size_t clgLength(const char* Text) {
+	std::size_t Length{ 0 };
+	while (Text[Length]) ++Length;
+	return Length;
+}
+
+//"\n[Category] Level: ", built at compile time for every category and level
+//the logger keeps the pointer until its background thread formats the record (possibly during exit),
+//so the text can't be something that gets destroyed, like a function-local static std::string
+template <typename Category, clgLevel Level>
+inline constexpr auto clgPrefixText{ [] {
+	std::array<char, clgLength(Category::clgName) + clgLength(clgLevelName(Level)) + 7> Text{};
+	std::size_t At{ 0 };
+	for (const char* Part : { "\n[", Category::clgName, "] ", clgLevelName(Level), ": " }) {
+		while (*Part) Text[At++] = *Part++;
+	}
+	return Text;
+}() };
+
+template <typename Category, clgLevel Level>
+constexpr const char* clgPrefix() {
+	return clgPrefixText<Category, Level>.data();
+}
+
+template <typename Category>
+void clgSetLevel(clgLevel Level) {
+	Category::clgRuntimeLevel.store(Level, std::memory_order_relaxed);
+}
+
+//DefaultLevel - starting run time minimum, CompileTimeLevel - calls below this are compiled out, Output - a clgOutput
+#define LOG_CATEGORY(Name, DefaultLevel, CompileTimeLevel, Output)										\
+	struct Name {																						\
+		static constexpr const char* clgName{ #Name };													\
+		static constexpr clgOutput clgWhere{ clgOutput::Output };										\
+		static constexpr clgLevel clgCompileTimeLevel{													\
+			clgMax(clgLevel::CompileTimeLevel, clgLevel::LOG_MIN_LEVEL) };								\
+		inline static std::atomic<clgLevel> clgRuntimeLevel{ clgLevel::DefaultLevel };					\
+	}
+
+//the arguments after Level are the format string and its arguments, like alogWrite
+#define LOG(Category, Level, ...)																		\
+	do {																								\
+		if constexpr (clgLevel::Level >= Category::clgCompileTimeLevel) {								\
+			if (clgLevel::Level >= Category::clgRuntimeLevel.load(std::memory_order_relaxed)) {		\
+				if constexpr (Category::clgWhere == clgOutput::Immediate) {								\
+					alogWritePrefixedNow(clgPrefix<Category, clgLevel::Level>(), __VA_ARGS__);			\
+				}																						\
+				else {																					\
+					alogWritePrefixed(clgPrefix<Category, clgLevel::Level>(), __VA_ARGS__);			\
+				}																						\
+			}																							\
+		}																								\
+	} while (false)
@@ -0,0 +1,147 @@
+#include "crtnScript.h"
+#include <algorithm>
+#include <memory>
+#include <new>
+
+namespace {
+	constexpr std::size_t crtnGranularity{ 16 };
+	//bigger frames are rare (huge locals), those go straight to operator new
+	constexpr std::size_t crtnLargest{ 1024 };
+	constexpr std::size_t crtnSlabSize{ 64 * 1024 };
+
+	struct crtnFreeFrame {
+		crtnFreeFrame* Next;
+	};
+
+	struct crtnFramePool {
+		crtnFreeFrame* Free[crtnLargest / crtnGranularity]{};
+		//slabs are only released when the thread exits
+		std::vector<std::unique_ptr<std::byte[]>> Slabs;
+		std::byte* SlabNext{ nullptr };
+		std::size_t SlabLeft{ 0 };
+		std::size_t BytesInUse{ 0 };
+	};
+
+	thread_local crtnFramePool crtnPool;
+
+	std::size_t crtnRound(std::size_t Size) { return (Size + crtnGranularity - 1) / crtnGranularity * crtnGranularity; }
+}
+
+void* crtnAllocate(std::size_t Size) {
+	const std::size_t Rounded{ crtnRound(Size) };
+	crtnPool.BytesInUse += Rounded;
+	if (Rounded > crtnLargest) return ::operator new(Rounded);
+
+	crtnFreeFrame*& Free{ crtnPool.Free[Rounded / crtnGranularity - 1] };
+	if (Free) {
+		void* Frame{ Free };
+		Free = Free->Next;
+		return Frame;
+	}
+	//operator new[] aligns the slab to __STDCPP_DEFAULT_NEW_ALIGNMENT__, every frame in it stays 16-byte aligned
+	if (crtnPool.SlabLeft < Rounded) {
+		crtnPool.Slabs.emplace_back(new std::byte[crtnSlabSize]);
+		crtnPool.SlabNext = crtnPool.Slabs.back().get();
+		crtnPool.SlabLeft = crtnSlabSize;
+	}
+	void* Frame{ crtnPool.SlabNext };
+	crtnPool.SlabNext += Rounded;
+	crtnPool.SlabLeft -= Rounded;
+	return Frame;
+}
+
+void crtnFree(void* Frame, std::size_t Size) {
+	const std::size_t Rounded{ crtnRound(Size) };
+	crtnPool.BytesInUse -= Rounded;
+	if (Rounded > crtnLargest) {
+		::operator delete(Frame);
+		return;
+	}
+	crtnFreeFrame*& Free{ crtnPool.Free[Rounded / crtnGranularity - 1] };
+	Free = new (Frame) crtnFreeFrame{ Free };
+}
+
+std::size_t crtnFrameBytes() {
+	return crtnPool.BytesInUse;
+}
+
+crtnScheduler::~crtnScheduler() {
+	for (crtnScript::crtnHandle Script : mScripts) {
+		if (crtnSignal* Signal{ Script.promise().WaitingOn }) Signal->crtnRemove(Script);
+		Script.destroy();
+	}
+}
+
+void crtnScheduler::crtnStart(crtnScript Script) {
+	crtnScript::crtnHandle Handle{ Script.mHandle };
+	Script.mHandle = nullptr;
+	Handle.promise().Scheduler = this;
+	Handle.promise().Slot = static_cast<std::uint32_t>(mScripts.size());
+	mScripts.push_back(Handle);
+	mReady.push_back(Handle);
+}
+
+void crtnScheduler::crtnTick() {
+	++mTick;
+	while (!mTimers.empty() && mTimers.front().WakeTick <= mTick) {
+		std::pop_heap(mTimers.begin(), mTimers.end(), crtnLater);
+		mReady.push_back(mTimers.back().Script);
+		mTimers.pop_back();
+	}
+	for (std::size_t Index{ 0 }; Index < mPolled.size();) {
+		if (mPolled[Index].Check(mPolled[Index].Awaiter)) {
+			mReady.push_back(mPolled[Index].Script);
+			mPolled[Index] = mPolled.back();
+			mPolled.pop_back();
+		}
+		else {
+			++Index;
+		}
+	}
+
+	std::swap(mReady, mRunning);
+	for (crtnScript::crtnHandle Script : mRunning) {
+		Script.resume();
+		++mResumes;
+		if (Script.done()) crtnRetire(Script);
+	}
+	mRunning.clear();
+}
+
+void crtnScheduler::crtnAddTimer(crtnScript::crtnHandle Script, std::uint64_t WakeTick) {
+	mTimers.push_back({ WakeTick, Script });
+	std::push_heap(mTimers.begin(), mTimers.end(), crtnLater);
+}
+
+void crtnScheduler::crtnAddPolled(crtnScript::crtnHandle Script, bool (*Check)(void*), void* Awaiter) {
+	mPolled.push_back({ Script, Check, Awaiter });
+}
+
+//swap-and-pop, the script moved into the gap gets its new slot
+void crtnScheduler::crtnRetire(crtnScript::crtnHandle Script) {
+	const std::uint32_t Slot{ Script.promise().Slot };
+	mScripts[Slot] = mScripts.back();
+	mScripts[Slot].promise().Slot = Slot;
+	mScripts.pop_back();
+	Script.destroy();
+}
+
+crtnSignal::~crtnSignal() {
+	for (crtnScript::crtnHandle Script : mWaiting) Script.promise().WaitingOn = nullptr;
+}
+
+void crtnSignal::crtnNotify() {
+	for (crtnScript::crtnHandle Script : mWaiting) {
+		Script.promise().WaitingOn = nullptr;
+		Script.promise().Scheduler->crtnMakeReady(Script);
+	}
+	mWaiting.clear();
+}
+
+void crtnSignal::crtnRemove(crtnScript::crtnHandle Script) {
+	const auto Found{ std::find(mWaiting.begin(), mWaiting.end(), Script) };
+	if (Found != mWaiting.end()) {
+		*Found = mWaiting.back();
+		mWaiting.pop_back();
+	}
+}
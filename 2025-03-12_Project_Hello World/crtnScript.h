@@ -0,0 +1,181 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <vector>
+
+//scripts for multi-step behaviors ("patrol, spot, chase, attack") written as C++20 coroutines, instead of hand-written state machines
+//
+//	crtnScript Guard(rtpCharacter& Self, rtpCharacter& Target, const bool& Spotted) {
+//		co_await crtnUntil{ [&Spotted] { return Spotted; } };
+//		co_await crtnWait{ 2 };
+//		Self.rtpAct(&Target);
+//	}
+//	Scheduler.crtnStart(Guard(Goblin, Player, Spotted));
+//
+//a script runs until it co_awaits, and continues from there once what it waits for is ready:
+// - crtnNextTick{} - the next tick
+// - crtnWait{ Ticks } - that many ticks from now
+// - crtnUntil{ Condition } - the first tick Condition() returns true (checked once per tick, w/out resuming the script)
+// - Signal.crtnWaitFor() - the tick after someone calls Signal.crtnNotify()
+//every tick, the scheduler only resumes the scripts that are ready
+//scripts, their scheduler and signals all live on one thread
+
+class crtnScheduler;
+class crtnSignal;
+
+// - frame allocation
+//coroutine frames come from per-thread free lists (one per 16-byte size class), carved from 64KB slabs
+void* crtnAllocate(std::size_t Size);
+void crtnFree(void* Frame, std::size_t Size);
+//bytes taken by frames that are currently alive on this thread (after rounding to the size class)
+std::size_t crtnFrameBytes();
+
+class crtnScript {
+public:
+	struct promise_type {
+		crtnScheduler* Scheduler{ nullptr };
+		//position in the scheduler's list of scripts
+		std::uint32_t Slot{ 0 };
+		//signal the script is waiting on, so whichever of the two goes away first can unlink it from the other
+		crtnSignal* WaitingOn{ nullptr };
+
+		crtnScript get_return_object() { return crtnScript{ std::coroutine_handle<promise_type>::from_promise(*this) }; }
+		//nothing runs until the scheduler's next tick
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		//the scheduler destroys finished scripts
+		std::suspend_always final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+
+		static void* operator new(std::size_t Size) { return crtnAllocate(Size); }
+		static void operator delete(void* Frame, std::size_t Size) { crtnFree(Frame, Size); }
+	};
+	using crtnHandle = std::coroutine_handle<promise_type>;
+
+	crtnScript(crtnScript&& Other) noexcept : mHandle{ Other.mHandle } { Other.mHandle = nullptr; }
+	crtnScript& operator=(crtnScript&&) = delete;
+	//a script that was never started is just destroyed
+	~crtnScript() {
+		if (mHandle) mHandle.destroy();
+	}
+
+private:
+	friend class crtnScheduler;
+	explicit crtnScript(crtnHandle Handle) : mHandle{ Handle } {}
+
+	crtnHandle mHandle;
+};
+
+class crtnScheduler {
+public:
+	crtnScheduler() = default;
+	//destroys every script that is still running (scripts waiting on a signal are removed from it first)
+	~crtnScheduler();
+	crtnScheduler(const crtnScheduler&) = delete;
+	crtnScheduler& operator=(const crtnScheduler&) = delete;
+
+	//the script starts running on the next tick
+	void crtnStart(crtnScript Script);
+	void crtnTick();
+
+	std::uint64_t crtnGetTick() const { return mTick; }
+	//scripts that haven't finished yet
+	std::size_t crtnAlive() const { return mScripts.size(); }
+	std::uint64_t crtnResumes() const { return mResumes; }
+
+	// - used by the awaitables
+	void crtnMakeReady(crtnScript::crtnHandle Script) { mReady.push_back(Script); }
+	void crtnAddTimer(crtnScript::crtnHandle Script, std::uint64_t WakeTick);
+	void crtnAddPolled(crtnScript::crtnHandle Script, bool (*Check)(void*), void* Awaiter);
+
+private:
+	struct crtnTimer {
+		std::uint64_t WakeTick;
+		crtnScript::crtnHandle Script;
+	};
+	struct crtnPolled {
+		crtnScript::crtnHandle Script;
+		bool (*Check)(void*);
+		void* Awaiter;
+	};
+
+	//the std heap functions keep the greatest element on top, so a later wake tick counts as smaller
+	static bool crtnLater(const crtnTimer& A, const crtnTimer& B) { return A.WakeTick > B.WakeTick; }
+	void crtnRetire(crtnScript::crtnHandle Script);
+
+	std::uint64_t mTick{ 0 };
+	std::uint64_t mResumes{ 0 };
+	std::vector<crtnScript::crtnHandle> mScripts;
+	std::vector<crtnScript::crtnHandle> mReady;
+	//swapped w mReady every tick, so scripts that become ready while it runs wait for the next one
+	std::vector<crtnScript::crtnHandle> mRunning;
+	//min-heap on WakeTick
+	std::vector<crtnTimer> mTimers;
+	std::vector<crtnPolled> mPolled;
+};
+
+// - awaitables
+struct crtnNextTick {
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(crtnScript::crtnHandle Script) const { Script.promise().Scheduler->crtnMakeReady(Script); }
+	void await_resume() const noexcept {}
+};
+
+struct crtnWait {
+	std::uint32_t Ticks;
+
+	bool await_ready() const noexcept { return Ticks == 0; }
+	void await_suspend(crtnScript::crtnHandle Script) const {
+		crtnScheduler& Scheduler{ *Script.promise().Scheduler };
+		Scheduler.crtnAddTimer(Script, Scheduler.crtnGetTick() + Ticks);
+	}
+	void await_resume() const noexcept {}
+};
+
+//Condition is stored in the script's frame while it waits, the scheduler only keeps a pointer to it
+template <typename Condition>
+struct crtnUntil {
+	Condition Check;
+
+	bool await_ready() { return Check(); }
+	void await_suspend(crtnScript::crtnHandle Script) {
+		Script.promise().Scheduler->crtnAddPolled(Script, [](void* Self) { return static_cast<crtnUntil*>(Self)->Check(); }, this);
+	}
+	void await_resume() const noexcept {}
+};
+template <typename Condition>
+crtnUntil(Condition) -> crtnUntil<Condition>;
+
+//event for scripts to wait on - unlike crtnUntil nothing is checked every tick, crtnNotify wakes the waiting scripts directly
+//either side can be destroyed first: a scheduler going away takes its scripts out of the signal,
+//and a signal going away leaves its scripts waiting forever (until their scheduler destroys them)
+class crtnSignal {
+public:
+	struct crtnAwaiter {
+		crtnSignal& Signal;
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(crtnScript::crtnHandle Script) const {
+			Script.promise().WaitingOn = &Signal;
+			Signal.mWaiting.push_back(Script);
+		}
+		void await_resume() const noexcept {}
+	};
+
+	crtnSignal() = default;
+	~crtnSignal();
+	crtnSignal(const crtnSignal&) = delete;
+	crtnSignal& operator=(const crtnSignal&) = delete;
+
+	crtnAwaiter crtnWaitFor() { return { *this }; }
+	//every script waiting right now continues on the next tick
+	void crtnNotify();
+
+private:
+	friend class crtnScheduler;
+	void crtnRemove(crtnScript::crtnHandle Script);
+
+	std::vector<crtnScript::crtnHandle> mWaiting;
+};
@@ -0,0 +1,82 @@
+#pragma once
+#include <algorithm>
+#include <barrier>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+//two-stage simulate/render pipeline over a double-buffered State
+//while the simulation writes frame N+1 into the back buffer, the render stage reads frame N from the front buffer on another thread
+//both stages meet at a barrier at the end of every frame, where the buffers swap - so render always sees one whole, consistent frame
+//
+//	dbufPipeline<World> Pipeline{ StartingWorld };
+//	Pipeline.dbufRun(Frames,
+//		[](const World& Current, World& Next) { ... },	//simulate
+//		[](const World& Frame) { ... });				//render
+//
+// - Simulate(Current, Next) has to write all of Next (it still holds the frame before Current, so its memory can be reused)
+// - Render(Frame) must not touch anything Simulate writes, other than through Frame
+
+struct dbufTiming {
+	int Frames;
+	double AverageFrameMs;
+	double WorstFrameMs;
+};
+
+template <typename State>
+class dbufPipeline {
+public:
+	explicit dbufPipeline(const State& Initial) : mBuffers{ Initial, Initial } {}
+
+	//latest complete frame (only while no dbufRun is in progress)
+	const State& dbufFront() const { return mBuffers[mFront]; }
+
+	//Overlap false runs render then simulate one after the other on the calling thread, eg. to compare frame times
+	template <typename Simulate, typename Render>
+	dbufTiming dbufRun(int Frames, Simulate&& Simulation, Render&& Rendering, bool Overlap = true);
+
+private:
+	State mBuffers[2];
+	int mFront{ 0 };
+};
+
+template <typename State>
+template <typename Simulate, typename Render>
+dbufTiming dbufPipeline<State>::dbufRun(int Frames, Simulate&& Simulation, Render&& Rendering, bool Overlap) {
+	using dbufClock = std::chrono::steady_clock;
+	dbufClock::time_point FrameStart{ dbufClock::now() };
+	double TotalMs{ 0.0 }, WorstMs{ 0.0 };
+	//a frame ends when both stages are done w it
+	const auto dbufEndFrame{ [&]() noexcept {
+		const dbufClock::time_point Now{ dbufClock::now() };
+		const double Ms{ std::chrono::duration<double, std::milli>(Now - FrameStart).count() };
+		TotalMs += Ms;
+		WorstMs = std::max(WorstMs, Ms);
+		FrameStart = Now;
+		mFront ^= 1;
+	} };
+
+	if (!Overlap) {
+		for (int Frame{ 0 }; Frame < Frames; ++Frame) {
+			Rendering(std::as_const(mBuffers[mFront]));
+			Simulation(std::as_const(mBuffers[mFront]), mBuffers[mFront ^ 1]);
+			dbufEndFrame();
+		}
+	}
+	else if (Frames > 0) {
+		//the completion step runs once both threads arrived, before either continues - the only place mFront changes
+		std::barrier Swap{ 2, dbufEndFrame };
+		std::thread Renderer{ [&] {
+			for (int Frame{ 0 }; Frame < Frames; ++Frame) {
+				Rendering(std::as_const(mBuffers[mFront]));
+				Swap.arrive_and_wait();
+			}
+		} };
+		for (int Frame{ 0 }; Frame < Frames; ++Frame) {
+			Simulation(std::as_const(mBuffers[mFront]), mBuffers[mFront ^ 1]);
+			Swap.arrive_and_wait();
+		}
+		Renderer.join();
+	}
+	return { Frames, Frames > 0 ? TotalMs / Frames : 0.0, WorstMs };
+}
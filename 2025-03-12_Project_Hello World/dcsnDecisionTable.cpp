@@ -0,0 +1,35 @@
+#include "dcsnDecisionTable.h"
+
+namespace {
+	constexpr dcsnTable dcsnRules{};
+	//entities are processed in blocks, so the actions of a block are still in cache when they're sorted into lists
+	constexpr int dcsnBlockSize{ 1024 };
+}
+
+void dcsnBatch::dcsnEvaluate(const dcsnColumns& Entities) {
+	const std::size_t Count{ static_cast<std::size_t>(Entities.Count) };
+	for (int Action{ 0 }; Action < dcsnActionCount; ++Action) {
+		if (mIndices[Action].size() < Count) mIndices[Action].resize(Count);
+		mCounts[Action] = 0;
+	}
+	mActions.resize(dcsnBlockSize);
+
+	for (int First{ 0 }; First < Entities.Count; First += dcsnBlockSize) {
+		const int Last{ First + dcsnBlockSize < Entities.Count ? First + dcsnBlockSize : Entities.Count };
+
+		//comparisons produce 0/1, so building the key doesn't branch (and the loop can be vectorized)
+		for (int i{ First }; i < Last; ++i) {
+			const int Health{ Entities.Health[i] };
+			const int Key{ ((Health > 0) + (Health > dcsnLowHealth)) * 8
+				+ Entities.CanHeal[i] * 4 + Entities.IsHostile[i] * 2 + Entities.CanSeePlayer[i] };
+			mActions[i - First] = static_cast<std::uint8_t>(dcsnRules.Actions[Key]);
+		}
+
+		//every index is written to the end of its action's list, only that list's count moves forward
+		for (int i{ First }; i < Last; ++i) {
+			const int Action{ mActions[i - First] };
+			mIndices[Action][mCounts[Action]] = static_cast<std::uint32_t>(i);
+			++mCounts[Action];
+		}
+	}
+}
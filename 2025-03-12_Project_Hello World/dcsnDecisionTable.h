@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+//the Health-threshold AI cascade as a decision table, evaluated for many entities at once
+//
+//	if (Health <= 0) DropLoot
+//	else if (Health <= 50) CanHeal ? CastHealingSpell : RunAway
+//	else if (IsHostile) CanSeePlayer ? Attack : PatrolArea
+//
+//per entity, each of those ifs is a branch the CPU has to guess, and w mixed entities it guesses wrong a lot
+//instead, the inputs are packed into a small number (key) w/out any branches, and the action is looked up in a table
+//entities are then sorted into one list per action, so each action's code runs once over its whole batch
+enum class dcsnAction : std::uint8_t {
+	None,
+	DropLoot,
+	CastHealingSpell,
+	RunAway,
+	Attack,
+	PatrolArea
+};
+constexpr int dcsnActionCount{ 6 };
+constexpr int dcsnLowHealth{ 50 };
+
+//the rules themselves, for a single entity - the table is generated from this, so the two can't disagree
+//HealthBucket: 0 - dead (<= 0), 1 - low (<= dcsnLowHealth), 2 - healthy
+constexpr dcsnAction dcsnDecide(int HealthBucket, bool CanHeal, bool IsHostile, bool CanSeePlayer) {
+	if (HealthBucket == 0) return dcsnAction::DropLoot;
+	if (HealthBucket == 1) return CanHeal ? dcsnAction::CastHealingSpell : dcsnAction::RunAway;
+	if (IsHostile) return CanSeePlayer ? dcsnAction::Attack : dcsnAction::PatrolArea;
+	return dcsnAction::None;
+}
+
+//key = HealthBucket * 8 + CanHeal * 4 + IsHostile * 2 + CanSeePlayer
+constexpr int dcsnKeyCount{ 3 * 8 };
+
+struct dcsnTable {
+	dcsnAction Actions[dcsnKeyCount]{};
+
+	constexpr dcsnTable() {
+		for (int Key{ 0 }; Key < dcsnKeyCount; ++Key) {
+			Actions[Key] = dcsnDecide(Key / 8, Key & 4, Key & 2, Key & 1);
+		}
+	}
+};
+
+//one column per input (struct of arrays), all Count long
+struct dcsnColumns {
+	const int* Health;
+	const bool* CanHeal;
+	const bool* IsHostile;
+	const bool* CanSeePlayer;
+	int Count;
+};
+
+//result of evaluating the table: for each action, the indices of the entities that should perform it
+class dcsnBatch {
+public:
+	void dcsnEvaluate(const dcsnColumns& Entities);
+
+	const std::uint32_t* dcsnEntities(dcsnAction Action) const { return mIndices[static_cast<int>(Action)].data(); }
+	int dcsnCount(dcsnAction Action) const { return mCounts[static_cast<int>(Action)]; }
+
+private:
+	//every list is sized for all entities up front, so appending never has to check (or branch on) the capacity
+	std::vector<std::uint32_t> mIndices[dcsnActionCount];
+	int mCounts[dcsnActionCount]{};
+	std::vector<std::uint8_t> mActions;
+};
@@ -0,0 +1,39 @@
+#include "flywWeapon.h"
+
+flywArchetypeId flywArchetypeTable::flywRegister(const flywArchetype& Archetype) {
+	flywArchetypeId Existing{ flywFind(Archetype.Name) };
+	if (Existing != flywInvalidId) {
+		return Existing;
+	}
+	if (mArchetypes.size() >= flywInvalidId) {
+		return flywInvalidId;
+	}
+	mArchetypes.push_back(Archetype);
+	return static_cast<flywArchetypeId>(mArchetypes.size() - 1);
+}
+
+flywArchetypeId flywArchetypeTable::flywFind(const std::string& Name) const {
+	for (std::size_t i{ 0 }; i < mArchetypes.size(); ++i) {
+		if (mArchetypes[i].Name == Name) {
+			return static_cast<flywArchetypeId>(i);
+		}
+	}
+	return flywInvalidId;
+}
+
+flywSword flywCreate(const flywArchetypeTable& Table, flywArchetypeId Archetype) {
+	return flywSword{ Archetype, 0, Table.flywGet(Archetype).MaxDurabillity };
+}
+
+int flywGetDamage(const flywArchetypeTable& Table, const flywSword& Sword) {
+	//every enchant level adds 10% of the base damage
+	int BaseDamage{ Table.flywGet(Sword.Archetype).Damage };
+	return BaseDamage + BaseDamage * Sword.EnchantLevel / 10;
+}
+
+void flywDecayDurabillity(std::vector<flywSword>& Swords, float Amount) {
+	for (flywSword& Sword : Swords) {
+		float Decayed{ Sword.Durabillity - Amount };
+		Sword.Durabillity = Decayed < 0.0f ? 0.0f : Decayed;
+	}
+}
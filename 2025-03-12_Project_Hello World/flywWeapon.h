@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//flyweight weapons
+//thousands of players may hold the same "Iron Sword" - storing its name and base stats in every instance wastes memory
+//instead, the shared (immutable) part lives once in a table, and every instance only refers to it by a small id
+
+struct flywArchetype {
+	std::string Name;
+	int Damage;
+	float MaxDurabillity;
+};
+
+using flywArchetypeId = std::uint16_t;
+constexpr flywArchetypeId flywInvalidId{ 0xFFFF };
+
+class flywArchetypeTable {
+public:
+	//registering the same Name twice returns the id of the existing archetype
+	flywArchetypeId flywRegister(const flywArchetype& Archetype);
+	flywArchetypeId flywFind(const std::string& Name) const;
+
+	//archetypes cannot be modified once registered, so only const access is provided
+	const flywArchetype& flywGet(flywArchetypeId Id) const { return mArchetypes[Id]; }
+	std::size_t flywSize() const { return mArchetypes.size(); }
+
+private:
+	std::vector<flywArchetype> mArchetypes;
+};
+
+//per-instance mutable state only
+struct flywSword {
+	flywArchetypeId Archetype;
+	std::uint8_t EnchantLevel;
+	float Durabillity;
+};
+static_assert(sizeof(flywSword) == 8, "flywSword should stay 8 bytes");
+
+flywSword flywCreate(const flywArchetypeTable& Table, flywArchetypeId Archetype);
+int flywGetDamage(const flywArchetypeTable& Table, const flywSword& Sword);
+
+//durability of every instance is reduced in a single pass (never below 0)
+void flywDecayDurabillity(std::vector<flywSword>& Swords, float Amount);
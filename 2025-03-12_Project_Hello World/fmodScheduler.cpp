@@ -0,0 +1,85 @@
+#include "fmodScheduler.h"
+#include <cassert>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace {
+	//high 64 bits of the 128-bit product
+	std::uint64_t fmodMulHigh(std::uint64_t A, std::uint64_t B) {
+#if defined(_MSC_VER) && defined(_M_X64)
+		return __umulh(A, B);
+#elif defined(__SIZEOF_INT128__)
+		return static_cast<std::uint64_t>((static_cast<unsigned __int128>(A) * B) >> 64);
+#else
+		const std::uint64_t ALow{ A & 0xFFFFFFFF }, AHigh{ A >> 32 };
+		const std::uint64_t BLow{ B & 0xFFFFFFFF }, BHigh{ B >> 32 };
+		const std::uint64_t Cross{ (ALow * BLow >> 32) + (AHigh * BLow & 0xFFFFFFFF) + ALow * BHigh };
+		return AHigh * BHigh + (AHigh * BLow >> 32) + (Cross >> 32);
+#endif
+	}
+}
+
+fmodDivisor::fmodDivisor(std::uint32_t Divisor)
+	: mDivisor{ Divisor }, mReciprocal{ UINT64_MAX / Divisor + 1 } {
+	assert(Divisor != 0);
+}
+
+//the low 64 bits of Reciprocal * N are the fractional part of N / Divisor, multiplying that by Divisor gives the remainder
+std::uint32_t fmodDivisor::fmodMod(std::uint32_t N) const {
+	//Divisor 1 makes the reciprocal wrap to 0, which gives the right answer (0) anyway
+	return static_cast<std::uint32_t>(fmodMulHigh(mReciprocal * N, mDivisor));
+}
+
+fmodTaskId fmodScheduler::fmodAdd(std::uint32_t Entity, std::uint32_t Period) {
+	assert(Period != 0);
+	std::uint32_t GroupIndex{ 0 };
+	while (GroupIndex < mGroups.size() && mGroups[GroupIndex].Divisor.fmodGetDivisor() != Period) ++GroupIndex;
+	if (GroupIndex == mGroups.size()) {
+		mGroups.push_back({ fmodDivisor{ Period }, std::vector<fmodBucket>(Period) });
+	}
+	fmodGroup& Group{ mGroups[GroupIndex] };
+
+	std::uint32_t Phase{ 0 };
+	for (std::uint32_t Candidate{ 1 }; Candidate < Period; ++Candidate) {
+		if (Group.Phases[Candidate].Entities.size() < Group.Phases[Phase].Entities.size()) Phase = Candidate;
+	}
+	fmodBucket& Bucket{ Group.Phases[Phase] };
+
+	fmodTaskId Task;
+	if (mFreeTasks.empty()) {
+		Task = static_cast<fmodTaskId>(mTasks.size());
+		mTasks.push_back({});
+	}
+	else {
+		Task = mFreeTasks.back();
+		mFreeTasks.pop_back();
+	}
+	mTasks[Task] = { GroupIndex, Phase, static_cast<std::uint32_t>(Bucket.Entities.size()) };
+	Bucket.Entities.push_back(Entity);
+	Bucket.Tasks.push_back(Task);
+	return Task;
+}
+
+//swap-and-pop within the bucket, so the due lists stay dense
+void fmodScheduler::fmodRemove(fmodTaskId Task) {
+	const fmodTask Removed{ mTasks[Task] };
+	fmodBucket& Bucket{ mGroups[Removed.Group].Phases[Removed.Phase] };
+	const fmodTaskId Moved{ Bucket.Tasks.back() };
+	Bucket.Entities[Removed.Slot] = Bucket.Entities.back();
+	Bucket.Tasks[Removed.Slot] = Moved;
+	mTasks[Moved].Slot = Removed.Slot;
+	Bucket.Entities.pop_back();
+	Bucket.Tasks.pop_back();
+	mFreeTasks.push_back(Task);
+}
+
+const std::vector<std::uint32_t>& fmodScheduler::fmodDue(std::uint32_t Tick) {
+	mDue.clear();
+	for (const fmodGroup& Group : mGroups) {
+		const std::vector<std::uint32_t>& Entities{ Group.Phases[Group.Divisor.fmodMod(Tick)].Entities };
+		mDue.insert(mDue.end(), Entities.begin(), Entities.end());
+	}
+	return mDue;
+}
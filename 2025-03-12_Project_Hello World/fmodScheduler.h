@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+//"every Nth tick" work (AI every 3rd tick, regen every 5th, ...) w/out a division per entity per tick
+
+// - fast modulus
+//N % Divisor for a Divisor fixed ahead of time, using a precomputed reciprocal: two multiplications instead of a division
+//(Lemire, Kaser, Kurz - "Faster Remainder by Direct Computation")
+class fmodDivisor {
+public:
+	explicit fmodDivisor(std::uint32_t Divisor);
+
+	std::uint32_t fmodMod(std::uint32_t N) const;
+	bool fmodIsDivisible(std::uint32_t N) const { return N * mReciprocal <= mReciprocal - 1; }
+	std::uint32_t fmodGetDivisor() const { return mDivisor; }
+
+private:
+	std::uint32_t mDivisor;
+	//ceil(2^64 / Divisor)
+	std::uint64_t mReciprocal;
+};
+
+// - staggered scheduler
+//every entity registered w a period gets a phase (0..Period - 1), it is due on ticks where Tick % Period == Phase
+//new entities go to the least used phase, so eg. 300 entities on period 3 run as 100 per tick, rather than 300 every 3rd tick
+//entities are kept in one bucket per phase, so finding who is due costs one modulus per period, not per entity
+using fmodTaskId = std::uint32_t;
+
+class fmodScheduler {
+public:
+	fmodTaskId fmodAdd(std::uint32_t Entity, std::uint32_t Period);
+	void fmodRemove(fmodTaskId Task);
+
+	//everyone due on Tick, as one dense list (valid until the next call)
+	//Tick is a 32-bit counter, when it wraps around the phases shift once (unless the period is a power of 2)
+	const std::vector<std::uint32_t>& fmodDue(std::uint32_t Tick);
+
+	std::uint32_t fmodGetPhase(fmodTaskId Task) const { return mTasks[Task].Phase; }
+	int fmodSize() const { return static_cast<int>(mTasks.size() - mFreeTasks.size()); }
+
+private:
+	struct fmodBucket {
+		std::vector<std::uint32_t> Entities;
+		//task of each entity, for fixing up the one moved into a removed entity's slot
+		std::vector<fmodTaskId> Tasks;
+	};
+
+	struct fmodGroup {
+		fmodDivisor Divisor;
+		std::vector<fmodBucket> Phases;
+	};
+
+	struct fmodTask {
+		std::uint32_t Group;
+		std::uint32_t Phase;
+		std::uint32_t Slot;
+	};
+
+	std::vector<fmodGroup> mGroups;
+	std::vector<fmodTask> mTasks;
+	std::vector<fmodTaskId> mFreeTasks;
+	std::vector<std::uint32_t> mDue;
+};
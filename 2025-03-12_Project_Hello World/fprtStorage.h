@@ -0,0 +1,127 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//entity storage partitioned by faction - all Goblins first, then all Undead, etc.
+//every faction is a contiguous range, so "all Trolls" is a loop over just the Trolls (rather than everyone + enmIsTroll checks)
+//entities keep a stable id, since their position changes as others are added, removed or switch faction
+using fprtId = std::uint32_t;
+
+template <typename T>
+class fprtRange {
+public:
+	fprtRange(T* First, T* Last) : mFirst{ First }, mLast{ Last } {}
+	T* begin() const { return mFirst; }
+	T* end() const { return mLast; }
+	int fprtSize() const { return static_cast<int>(mLast - mFirst); }
+
+private:
+	T* mFirst;
+	T* mLast;
+};
+
+template <typename T, typename Faction, int Count>
+class fprtStorage {
+public:
+	fprtId fprtAdd(Faction EntityFaction, T Entity) {
+		fprtId Id;
+		if (mFreeIds.empty()) {
+			Id = static_cast<fprtId>(mIndexOf.size());
+			mIndexOf.push_back(0);
+			mFactionOf.push_back(EntityFaction);
+		}
+		else {
+			Id = mFreeIds.back();
+			mFreeIds.pop_back();
+		}
+		//new entity starts at the very end (the last partition), then moves down to its own
+		mIndexOf[Id] = static_cast<std::uint32_t>(mEntities.size());
+		mFactionOf[Id] = static_cast<Faction>(Count - 1);
+		mEntities.push_back(std::move(Entity));
+		mIds.push_back(Id);
+		++mOffsets[Count];
+		fprtSetFaction(Id, EntityFaction);
+		return Id;
+	}
+
+	void fprtRemove(fprtId Id) {
+		//move to the last partition, then to the very end, so it can be popped
+		fprtSetFaction(Id, static_cast<Faction>(Count - 1));
+		fprtSwap(mIndexOf[Id], static_cast<std::uint32_t>(mEntities.size() - 1));
+		mEntities.pop_back();
+		mIds.pop_back();
+		--mOffsets[Count];
+		mFreeIds.push_back(Id);
+	}
+
+	//moves the entity across the partitions in between w one swap per boundary, so the cost doesn't depend on the number of entities
+	void fprtSetFaction(fprtId Id, Faction NewFaction) {
+		int From{ static_cast<int>(mFactionOf[Id]) };
+		const int To{ static_cast<int>(NewFaction) };
+		std::uint32_t Index{ mIndexOf[Id] };
+		//moving up - becomes the last of its partition, then the boundary moves down past it
+		for (; From < To; ++From) {
+			const std::uint32_t Last{ mOffsets[From + 1] - 1 };
+			fprtSwap(Index, Last);
+			Index = Last;
+			--mOffsets[From + 1];
+		}
+		//moving down - becomes the first of its partition, then the boundary moves up past it
+		for (; From > To; --From) {
+			const std::uint32_t First{ mOffsets[From] };
+			fprtSwap(Index, First);
+			Index = First;
+			++mOffsets[From];
+		}
+		mFactionOf[Id] = NewFaction;
+	}
+
+	Faction fprtGetFaction(fprtId Id) const { return mFactionOf[Id]; }
+	T& fprtGet(fprtId Id) { return mEntities[mIndexOf[Id]]; }
+	const T& fprtGet(fprtId Id) const { return mEntities[mIndexOf[Id]]; }
+
+	//O(1) - just the distance between two partition boundaries
+	int fprtCount(Faction Of) const {
+		return static_cast<int>(mOffsets[static_cast<int>(Of) + 1] - mOffsets[static_cast<int>(Of)]);
+	}
+	int fprtSize() const { return static_cast<int>(mEntities.size()); }
+
+	fprtRange<T> fprtAll(Faction Of) {
+		T* Data{ mEntities.data() };
+		return { Data + mOffsets[static_cast<int>(Of)], Data + mOffsets[static_cast<int>(Of) + 1] };
+	}
+	fprtRange<const T> fprtAll(Faction Of) const {
+		const T* Data{ mEntities.data() };
+		return { Data + mOffsets[static_cast<int>(Of)], Data + mOffsets[static_cast<int>(Of) + 1] };
+	}
+	//ids in the same order as fprtAll(), for when we need to know which entity we're looking at
+	const fprtId* fprtIds(Faction Of) const { return mIds.data() + mOffsets[static_cast<int>(Of)]; }
+
+	void fprtReserve(int Capacity) {
+		mEntities.reserve(Capacity);
+		mIds.reserve(Capacity);
+		mIndexOf.reserve(Capacity);
+		mFactionOf.reserve(Capacity);
+	}
+
+private:
+	void fprtSwap(std::uint32_t A, std::uint32_t B) {
+		if (A == B) return;
+		std::swap(mEntities[A], mEntities[B]);
+		std::swap(mIds[A], mIds[B]);
+		mIndexOf[mIds[A]] = A;
+		mIndexOf[mIds[B]] = B;
+	}
+
+	std::vector<T> mEntities;
+	//index -> id
+	std::vector<fprtId> mIds;
+	//id -> index / faction
+	std::vector<std::uint32_t> mIndexOf;
+	std::vector<Faction> mFactionOf;
+	std::vector<fprtId> mFreeIds;
+	//faction N occupies [mOffsets[N], mOffsets[N + 1])
+	std::uint32_t mOffsets[Count + 1]{};
+};
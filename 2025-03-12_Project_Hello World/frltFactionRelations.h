@@ -0,0 +1,163 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+//who is hostile to whom, for any enum class of factions (eg. enmFaction)
+enum class frltRelation : std::uint8_t {
+	Hostile,
+	Neutral,
+	Allied
+};
+
+//constexpr Count x Count table - relation of faction A towards faction B is Relations[A][B]
+//alongside the table we keep, per faction, a mask of the factions hostile to it, so queries don't have to walk the table
+template <typename Faction, int Count>
+class frltRelationTable {
+	static_assert(Count > 0 && Count <= 64, "faction masks are stored in a single 64-bit word");
+
+public:
+	constexpr frltRelationTable(const frltRelation (&Relations)[Count][Count]) {
+		for (int A{ 0 }; A < Count; ++A) {
+			for (int B{ 0 }; B < Count; ++B) {
+				mRelations[A][B] = Relations[A][B];
+				if (Relations[A][B] == frltRelation::Hostile) {
+					mHostileTo[B] |= std::uint64_t{ 1 } << A;
+				}
+			}
+		}
+	}
+
+	constexpr frltRelation frltGet(Faction A, Faction B) const {
+		return mRelations[static_cast<int>(A)][static_cast<int>(B)];
+	}
+	constexpr bool frltIsHostile(Faction A, Faction B) const { return frltGet(A, B) == frltRelation::Hostile; }
+	//bit N is set if faction N is hostile towards Target
+	constexpr std::uint64_t frltHostileMask(Faction Target) const { return mHostileTo[static_cast<int>(Target)]; }
+
+private:
+	frltRelation mRelations[Count][Count]{};
+	std::uint64_t mHostileTo[Count]{};
+};
+
+//set of entity indices, one bit per entity (so 64 entities are handled by every word operation)
+class frltEntitySet {
+public:
+	frltEntitySet() = default;
+	explicit frltEntitySet(int Size) { frltResize(Size); }
+
+	void frltResize(int Size) {
+		mSize = Size;
+		mWords.resize((static_cast<std::size_t>(Size) + 63) / 64, 0);
+		frltTrim();
+	}
+	int frltSize() const { return mSize; }
+
+	void frltInsert(int Index) {
+		assert(Index >= 0 && Index < mSize);
+		mWords[Index / 64] |= std::uint64_t{ 1 } << (Index % 64);
+	}
+	void frltErase(int Index) {
+		assert(Index >= 0 && Index < mSize);
+		mWords[Index / 64] &= ~(std::uint64_t{ 1 } << (Index % 64));
+	}
+	bool frltContains(int Index) const {
+		assert(Index >= 0 && Index < mSize);
+		return (mWords[Index / 64] >> (Index % 64)) & 1;
+	}
+	void frltInsertAll() {
+		for (std::uint64_t& Word : mWords) Word = ~std::uint64_t{ 0 };
+		frltTrim();
+	}
+	void frltClear() {
+		for (std::uint64_t& Word : mWords) Word = 0;
+	}
+
+	int frltCount() const {
+		int Count{ 0 };
+		for (std::uint64_t Word : mWords) {
+			//clears the lowest set bit each time round
+			for (; Word; Word &= Word - 1) ++Count;
+		}
+		return Count;
+	}
+
+	//calls Action(Index) for every entity in the set, in ascending order
+	template <typename Callable>
+	void frltForEach(Callable Action) const {
+		for (std::size_t WordIndex{ 0 }; WordIndex < mWords.size(); ++WordIndex) {
+			for (std::uint64_t Word{ mWords[WordIndex] }; Word; Word &= Word - 1) {
+				int Bit{ 0 };
+				while (!((Word >> Bit) & 1)) ++Bit;
+				Action(static_cast<int>(WordIndex * 64) + Bit);
+			}
+		}
+	}
+
+	std::vector<std::uint64_t>& frltWords() { return mWords; }
+	const std::vector<std::uint64_t>& frltWords() const { return mWords; }
+
+private:
+	//bits past mSize in the last word always stay 0
+	void frltTrim() {
+		if (mSize % 64 && !mWords.empty()) {
+			mWords.back() &= (std::uint64_t{ 1 } << (mSize % 64)) - 1;
+		}
+	}
+
+	int mSize{ 0 };
+	std::vector<std::uint64_t> mWords;
+};
+
+//faction of every entity, stored as a column (entity index -> faction)
+//plus one frltEntitySet per faction, which is what the bulk queries run over
+template <typename Faction, int Count>
+class frltFactionColumn {
+public:
+	using frltTable = frltRelationTable<Faction, Count>;
+
+	int frltAdd(Faction EntityFaction) {
+		const int Index{ static_cast<int>(mFactions.size()) };
+		mFactions.push_back(EntityFaction);
+		for (frltEntitySet& Members : mMembers) {
+			Members.frltResize(Index + 1);
+		}
+		mMembers[static_cast<int>(EntityFaction)].frltInsert(Index);
+		return Index;
+	}
+
+	void frltSetFaction(int Index, Faction NewFaction) {
+		mMembers[static_cast<int>(mFactions[Index])].frltErase(Index);
+		mFactions[Index] = NewFaction;
+		mMembers[static_cast<int>(NewFaction)].frltInsert(Index);
+	}
+
+	Faction frltGetFaction(int Index) const { return mFactions[Index]; }
+	int frltSize() const { return static_cast<int>(mFactions.size()); }
+	const frltEntitySet& frltMembers(Faction Of) const { return mMembers[static_cast<int>(Of)]; }
+
+	//Out = entities from Within that are hostile to Target
+	//OR together the member sets of every hostile faction, then AND w Within - all a word (64 entities) at a time
+	void frltQueryHostile(const frltTable& Table, Faction Target, const frltEntitySet& Within, frltEntitySet& Out) const {
+		assert(Within.frltSize() == frltSize());
+		Out.frltResize(frltSize());
+		Out.frltClear();
+		std::vector<std::uint64_t>& OutWords{ Out.frltWords() };
+		const std::uint64_t HostileMask{ Table.frltHostileMask(Target) };
+		for (int Other{ 0 }; Other < Count; ++Other) {
+			if (!((HostileMask >> Other) & 1)) continue;
+			const std::vector<std::uint64_t>& MemberWords{ mMembers[Other].frltWords() };
+			for (std::size_t Word{ 0 }; Word < OutWords.size(); ++Word) {
+				OutWords[Word] |= MemberWords[Word];
+			}
+		}
+		const std::vector<std::uint64_t>& WithinWords{ Within.frltWords() };
+		for (std::size_t Word{ 0 }; Word < OutWords.size(); ++Word) {
+			OutWords[Word] &= WithinWords[Word];
+		}
+	}
+
+private:
+	std::vector<Faction> mFactions;
+	frltEntitySet mMembers[Count];
+};
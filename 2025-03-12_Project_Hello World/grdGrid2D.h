@@ -0,0 +1,166 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+//contiguous 2D grid
+//std::vector<std::vector<int>> allocates every row separately and needs two dependent loads per [Row][Col]
+//grdGrid2D keeps all cells in one allocation; how cells are ordered within it is decided by the Layout
+
+// - layouts
+//row-major: rows are stored one after another (fast when walking along rows)
+struct grdRowMajor {
+	static std::size_t grdCapacity(int Rows, int Cols) {
+		return static_cast<std::size_t>(Rows) * Cols;
+	}
+	static std::size_t grdIndex(int Row, int Col, int Stride) {
+		return static_cast<std::size_t>(Row) * Stride + Col;
+	}
+};
+
+//Z-order (Morton): bits of Row and Col are interleaved, so cells that are close in both directions stay close in memory
+//(good for neighbourhood queries, but rows are no longer contiguous)
+//a single Morton curve over the whole grid would need max(Rows, Cols)^2 cells for non-square grids (eg. 1024x8)
+//so the grid is cut into 8x8 tiles instead - tiles are stored row-major, and cells inside a tile in Z-order
+//(only the last row/column of tiles is padded, so storage stays within 8 cells of Rows and Cols)
+struct grdZOrder {
+	static constexpr int grdTileShift{ 3 };
+	static constexpr int grdTileMask{ (1 << grdTileShift) - 1 };
+
+	static std::uint32_t grdSpread(std::uint32_t Value) {
+		Value &= 0x0000FFFF;
+		Value = (Value | (Value << 8)) & 0x00FF00FF;
+		Value = (Value | (Value << 4)) & 0x0F0F0F0F;
+		Value = (Value | (Value << 2)) & 0x33333333;
+		Value = (Value | (Value << 1)) & 0x55555555;
+		return Value;
+	}
+	static std::size_t grdTiles(int Cells) {
+		return (static_cast<std::size_t>(Cells) + grdTileMask) >> grdTileShift;
+	}
+	static std::size_t grdCapacity(int Rows, int Cols) {
+		return grdTiles(Rows) * grdTiles(Cols) << (2 * grdTileShift);
+	}
+	//Stride is the number of columns of the whole grid
+	static std::size_t grdIndex(int Row, int Col, int Stride) {
+		const std::size_t Tile{ (static_cast<std::size_t>(Row) >> grdTileShift) * grdTiles(Stride) + (static_cast<std::size_t>(Col) >> grdTileShift) };
+		const std::uint32_t InTile{ (grdSpread(static_cast<std::uint32_t>(Row & grdTileMask)) << 1) | grdSpread(static_cast<std::uint32_t>(Col & grdTileMask)) };
+		return (Tile << (2 * grdTileShift)) | InTile;
+	}
+};
+
+// - views
+//a view refers to a rectangle of an existing grid - nothing is copied, and writes through the view modify the grid
+//T may be const for read-only views
+template <typename T, typename Layout>
+class grdView {
+public:
+	grdView(T* Cells, int Stride, int Row0, int Col0, int Rows, int Cols)
+		: mCells{ Cells }, mStride{ Stride }, mRow0{ Row0 }, mCol0{ Col0 }, mRows{ Rows }, mCols{ Cols } {}
+
+	T& operator()(int Row, int Col) const {
+		assert(Row >= 0 && Row < mRows && Col >= 0 && Col < mCols);
+		return mCells[Layout::grdIndex(mRow0 + Row, mCol0 + Col, mStride)];
+	}
+
+	int grdRows() const { return mRows; }
+	int grdCols() const { return mCols; }
+
+	grdView grdSubrect(int Row, int Col, int Rows, int Cols) const {
+		assert(Row >= 0 && Col >= 0 && Rows >= 0 && Cols >= 0 && Row + Rows <= mRows && Col + Cols <= mCols);
+		return { mCells, mStride, mRow0 + Row, mCol0 + Col, Rows, Cols };
+	}
+	grdView grdRow(int Row) const { return grdSubrect(Row, 0, 1, mCols); }
+	grdView grdCol(int Col) const { return grdSubrect(0, Col, mRows, 1); }
+
+private:
+	T* mCells;
+	int mStride;
+	int mRow0;
+	int mCol0;
+	int mRows;
+	int mCols;
+};
+
+// - grid
+//operator() checks bounds w assert only (debug builds, release access is just index arithmetic and goes out of range silently)
+//grdAt() checks in every build, for indices that come from outside (eg. loaded data) rather than from our own loops
+template <typename T, typename Layout = grdRowMajor>
+class grdGrid2D {
+public:
+	using grdMutableView = grdView<T, Layout>;
+	using grdConstView = grdView<const T, Layout>;
+
+	grdGrid2D() = default;
+	grdGrid2D(int Rows, int Cols, const T& Value = T{})
+		: mRows{ Rows }, mCols{ Cols }, mCells(Layout::grdCapacity(Rows, Cols), Value) {}
+
+	//conversion from the nested vector representation (eg. dnmcafGrid) - rows shorter than the first one are padded w T{}
+	explicit grdGrid2D(const std::vector<std::vector<T>>& Nested)
+		: grdGrid2D(static_cast<int>(Nested.size()), Nested.empty() ? 0 : static_cast<int>(Nested[0].size())) {
+		for (int Row{ 0 }; Row < mRows; ++Row) {
+			for (int Col{ 0 }; Col < mCols && Col < static_cast<int>(Nested[Row].size()); ++Col) {
+				(*this)(Row, Col) = Nested[Row][Col];
+			}
+		}
+	}
+
+	T& operator()(int Row, int Col) {
+		assert(Row >= 0 && Row < mRows && Col >= 0 && Col < mCols);
+		return mCells[Layout::grdIndex(Row, Col, mCols)];
+	}
+	const T& operator()(int Row, int Col) const {
+		assert(Row >= 0 && Row < mRows && Col >= 0 && Col < mCols);
+		return mCells[Layout::grdIndex(Row, Col, mCols)];
+	}
+
+	T& grdAt(int Row, int Col) {
+		if (Row < 0 || Row >= mRows || Col < 0 || Col >= mCols) throw std::out_of_range{ "grdGrid2D cell out of range" };
+		return mCells[Layout::grdIndex(Row, Col, mCols)];
+	}
+	const T& grdAt(int Row, int Col) const {
+		if (Row < 0 || Row >= mRows || Col < 0 || Col >= mCols) throw std::out_of_range{ "grdGrid2D cell out of range" };
+		return mCells[Layout::grdIndex(Row, Col, mCols)];
+	}
+
+	int grdRows() const { return mRows; }
+	int grdCols() const { return mCols; }
+
+	//raw storage, in layout order (Z-order grids may contain some unused padding cells)
+	T* grdData() { return mCells.data(); }
+	const T* grdData() const { return mCells.data(); }
+	std::size_t grdStorageSize() const { return mCells.size(); }
+
+	//only row-major rows are contiguous, so only they can be handed out as plain pointers
+	T* grdRowData(int Row) {
+		static_assert(std::is_same_v<Layout, grdRowMajor>, "rows are only contiguous in row-major grids");
+		assert(Row >= 0 && Row < mRows);
+		return mCells.data() + static_cast<std::size_t>(Row) * mCols;
+	}
+	const T* grdRowData(int Row) const {
+		static_assert(std::is_same_v<Layout, grdRowMajor>, "rows are only contiguous in row-major grids");
+		assert(Row >= 0 && Row < mRows);
+		return mCells.data() + static_cast<std::size_t>(Row) * mCols;
+	}
+
+	void grdFill(const T& Value) {
+		for (T& Cell : mCells) Cell = Value;
+	}
+
+	grdMutableView grdAll() { return { mCells.data(), mCols, 0, 0, mRows, mCols }; }
+	grdConstView grdAll() const { return { mCells.data(), mCols, 0, 0, mRows, mCols }; }
+	grdMutableView grdSubrect(int Row, int Col, int Rows, int Cols) { return grdAll().grdSubrect(Row, Col, Rows, Cols); }
+	grdConstView grdSubrect(int Row, int Col, int Rows, int Cols) const { return grdAll().grdSubrect(Row, Col, Rows, Cols); }
+	grdMutableView grdRow(int Row) { return grdAll().grdRow(Row); }
+	grdConstView grdRow(int Row) const { return grdAll().grdRow(Row); }
+	grdMutableView grdCol(int Col) { return grdAll().grdCol(Col); }
+	grdConstView grdCol(int Col) const { return grdAll().grdCol(Col); }
+
+private:
+	int mRows{ 0 };
+	int mCols{ 0 };
+	std::vector<T> mCells;
+};
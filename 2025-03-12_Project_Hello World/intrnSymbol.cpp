@@ -0,0 +1,128 @@
+#include "intrnSymbol.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace {
+	//arena - text of every symbol is copied here once and never freed or moved
+	constexpr std::uint64_t intrnChunkSize{ 1 << 16 };
+	constexpr std::uint64_t intrnMaxChunks{ 1 << 12 };
+
+	//entries - id -> text, allocated in blocks so they never move either
+	constexpr std::uint32_t intrnEntriesPerBlock{ 1 << 12 };
+	constexpr std::uint32_t intrnMaxBlocks{ 1 << 8 };
+
+	//open-addressing hash table of ids, 0 marks an empty slot
+	constexpr std::uint32_t intrnSlotCount{ 1 << 21 };
+
+	struct intrnEntry {
+		const char* Data;
+		std::uint32_t Size;
+		std::uint64_t Hash;
+	};
+
+	std::atomic<char*> intrnChunks[intrnMaxChunks];
+	std::atomic<std::uint64_t> intrnCursor{ 0 };
+	std::atomic<intrnEntry*> intrnBlocks[intrnMaxBlocks];
+	std::atomic<std::uint32_t> intrnNextId{ 1 };
+	std::atomic<std::uint32_t> intrnSlots[intrnSlotCount];
+
+	//running out of ids, arena or table space can't be recovered from (symbols are never freed), so it stops the program in every build
+	[[noreturn]] void intrnFail(const char* Reason) {
+		std::cerr << "\nintrnSymbol: " << Reason << '\n';
+		std::abort();
+	}
+
+	//whoever loses the race to allocate a block deletes their own copy and uses the winner's
+	template <typename T>
+	T* intrnEnsure(std::atomic<T*>& Block, std::size_t Count) {
+		T* Current{ Block.load(std::memory_order_acquire) };
+		if (Current) return Current;
+		T* Created{ new T[Count]() };
+		if (Block.compare_exchange_strong(Current, Created, std::memory_order_acq_rel)) {
+			return Created;
+		}
+		delete[] Created;
+		return Current;
+	}
+
+	const char* intrnAllocate(std::string_view Text) {
+		//text bigger than a chunk would never fit in one - it gets its own allocation (also never freed)
+		if (Text.size() > intrnChunkSize) {
+			char* Destination{ new char[Text.size()] };
+			std::memcpy(Destination, Text.data(), Text.size());
+			return Destination;
+		}
+		while (true) {
+			std::uint64_t Offset{ intrnCursor.fetch_add(Text.size(), std::memory_order_relaxed) };
+			std::uint64_t First{ Offset / intrnChunkSize };
+			std::uint64_t Last{ (Offset + Text.size() - 1) / intrnChunkSize };
+			if (Last >= intrnMaxChunks) intrnFail("out of arena chunks");
+			//text would straddle two chunks - the tail of this chunk is simply skipped
+			if (First != Last) continue;
+			char* Chunk{ intrnEnsure(intrnChunks[First], intrnChunkSize) };
+			char* Destination{ Chunk + Offset % intrnChunkSize };
+			std::memcpy(Destination, Text.data(), Text.size());
+			return Destination;
+		}
+	}
+
+	intrnEntry& intrnGetEntry(std::uint32_t Id) {
+		intrnEntry* Block{ intrnEnsure(intrnBlocks[Id / intrnEntriesPerBlock], intrnEntriesPerBlock) };
+		return Block[Id % intrnEntriesPerBlock];
+	}
+
+	std::uint64_t intrnHash(std::string_view Text) {
+		//FNV-1a
+		std::uint64_t Hash{ 14695981039346656037ull };
+		for (char Character : Text) {
+			Hash ^= static_cast<unsigned char>(Character);
+			Hash *= 1099511628211ull;
+		}
+		return Hash;
+	}
+
+	std::uint32_t intrnIntern(std::string_view Text) {
+		if (Text.empty()) return 0;
+
+		std::uint64_t Hash{ intrnHash(Text) };
+		std::uint32_t Created{ 0 };
+		std::uint32_t Slot{ static_cast<std::uint32_t>(Hash) & (intrnSlotCount - 1) };
+		for (std::uint32_t Probe{ 0 }; Probe < intrnSlotCount; ++Probe) {
+			std::uint32_t Id{ intrnSlots[Slot].load(std::memory_order_acquire) };
+			if (Id == 0) {
+				//new text - the entry is fully written before its id is published in the slot
+				if (Created == 0) {
+					Created = intrnNextId.fetch_add(1, std::memory_order_relaxed);
+					if (Created >= intrnEntriesPerBlock * intrnMaxBlocks) intrnFail("out of symbol ids");
+					intrnGetEntry(Created) = { intrnAllocate(Text), static_cast<std::uint32_t>(Text.size()), Hash };
+				}
+				if (intrnSlots[Slot].compare_exchange_strong(Id, Created, std::memory_order_acq_rel)) {
+					return Created;
+				}
+				//another thread claimed this slot first, Id now holds their symbol
+			}
+			const intrnEntry& Entry{ intrnGetEntry(Id) };
+			if (Entry.Hash == Hash && std::string_view{ Entry.Data, Entry.Size } == Text) {
+				//if we lost a race for the same text, our own entry is left unused (append-only, so it is never reclaimed)
+				return Id;
+			}
+			Slot = (Slot + 1) & (intrnSlotCount - 1);
+		}
+		//returning 0 here would silently turn Text into the empty symbol
+		intrnFail("symbol table is full");
+	}
+}
+
+intrnSymbol::intrnSymbol(std::string_view Text) : mId{ intrnIntern(Text) } {}
+
+std::string_view intrnSymbol::intrnView() const {
+	if (mId == 0) return {};
+	const intrnEntry& Entry{ intrnGetEntry(mId) };
+	return { Entry.Data, Entry.Size };
+}
+
+std::ostream& operator<<(std::ostream& Stream, intrnSymbol Symbol) {
+	return Stream << Symbol.intrnView();
+}
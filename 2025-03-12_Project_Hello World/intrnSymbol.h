@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+//interned string (symbol)
+//every distinct text is stored only once, in a global append-only arena, and a symbol is just a 32-bit id of that text
+//copying, comparing and hashing symbols is as cheap as doing the same w an int (no allocations, no character-by-character compare)
+//interning is lock-free, so symbols can be created from any thread
+class intrnSymbol {
+public:
+	//id 0 is reserved for the empty string
+	intrnSymbol() = default;
+	intrnSymbol(std::string_view Text);
+	intrnSymbol(const char* Text) : intrnSymbol{ std::string_view{ Text } } {}
+	intrnSymbol(const std::string& Text) : intrnSymbol{ std::string_view{ Text } } {}
+
+	//the returned view stays valid for the whole run of the program
+	std::string_view intrnView() const;
+	operator std::string_view() const { return intrnView(); }
+
+	std::uint32_t intrnId() const { return mId; }
+	bool intrnIsEmpty() const { return mId == 0; }
+
+	friend bool operator==(intrnSymbol A, intrnSymbol B) { return A.mId == B.mId; }
+	friend bool operator!=(intrnSymbol A, intrnSymbol B) { return A.mId != B.mId; }
+
+private:
+	std::uint32_t mId{ 0 };
+};
+
+std::ostream& operator<<(std::ostream& Stream, intrnSymbol Symbol);
+
+namespace std {
+	template <>
+	struct hash<intrnSymbol> {
+		std::size_t operator()(intrnSymbol Symbol) const noexcept {
+			//ids are sequential, so they're spread out before being used as a hash
+			return static_cast<std::size_t>(Symbol.intrnId() * 0x9E3779B97F4A7C15ull);
+		}
+	};
+}
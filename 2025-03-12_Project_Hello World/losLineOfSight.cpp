@@ -0,0 +1,225 @@
+#include "losLineOfSight.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define LOS_SSE2 1
+#else
+#define LOS_SSE2 0
+#endif
+
+//the cells of a line between two cell centers are walked w integer error terms (no floating point):
+//Error compares how far the line is from the next column boundary vs the next row boundary,
+//it steps into the column when Error > 0, into the row when Error < 0, and through the corner (both at once) when it's 0
+
+bool losCanSee(const grdGrid2D<int>& Grid, losCell From, losCell To) {
+	const int ColCount{ std::abs(To.Col - From.Col) }, RowCount{ std::abs(To.Row - From.Row) };
+	const int ColStep{ To.Col > From.Col ? 1 : -1 }, RowStep{ To.Row > From.Row ? 1 : -1 };
+	int Error{ ColCount - RowCount };
+	int Remaining{ ColCount + RowCount };
+	losCell Cell{ From };
+	while (Remaining > 0) {
+		const int Before{ Error };
+		if (Before >= 0) {
+			Cell.Col += ColStep;
+			Error -= 2 * RowCount;
+			--Remaining;
+		}
+		if (Before <= 0) {
+			Cell.Row += RowStep;
+			Error += 2 * ColCount;
+			--Remaining;
+		}
+		if (Remaining > 0 && Grid(Cell.Row, Cell.Col) <= 0) return false;
+	}
+	return true;
+}
+
+#if LOS_SSE2
+namespace {
+	//lane state, stored while lanes are being refilled
+	struct alignas(16) losLanes4 {
+		//cell the lane is at (Row * Cols + Col), and how much a column / row step moves it
+		std::int32_t Index[4];
+		std::int32_t ColDelta[4];
+		std::int32_t RowDelta[4];
+		std::int32_t Error[4];
+		std::int32_t TwiceRowCount[4];
+		std::int32_t TwiceColCount[4];
+		std::int32_t Remaining[4];
+		//all bits set once a blocked cell was seen
+		std::int32_t Blocked[4];
+		//which ray the lane is tracing (-1 if none)
+		std::int32_t Ray[4];
+	};
+
+	//loads ray Ray into Lane, false if there was nothing to trace (From == To, or no cells in between)
+	bool losLoadLane(losLanes4& Lanes, int Lane, const losPair& Pair, int Ray, int Cols) {
+		const int ColCount{ std::abs(Pair.To.Col - Pair.From.Col) }, RowCount{ std::abs(Pair.To.Row - Pair.From.Row) };
+		if (ColCount + RowCount <= 1) return false;
+		Lanes.Index[Lane] = Pair.From.Row * Cols + Pair.From.Col;
+		Lanes.ColDelta[Lane] = Pair.To.Col > Pair.From.Col ? 1 : -1;
+		Lanes.RowDelta[Lane] = Pair.To.Row > Pair.From.Row ? Cols : -Cols;
+		Lanes.Error[Lane] = ColCount - RowCount;
+		Lanes.TwiceRowCount[Lane] = 2 * RowCount;
+		Lanes.TwiceColCount[Lane] = 2 * ColCount;
+		Lanes.Remaining[Lane] = ColCount + RowCount;
+		Lanes.Blocked[Lane] = 0;
+		Lanes.Ray[Lane] = Ray;
+		return true;
+	}
+}
+#endif
+
+void losCanSee(const grdGrid2D<int>& Grid, const losPair* Pairs, int Count, bool* Out) {
+	if (Count <= 0) return;
+	assert(Grid.grdRows() > 0 && Grid.grdCols() > 0);
+#if LOS_SSE2
+	const int* Cells{ Grid.grdData() };
+	const int Cols{ Grid.grdCols() };
+	//an empty lane sits at cell 0 w nothing remaining, so it never moves and never reads outside the grid
+	losLanes4 Lanes{};
+	for (int Lane{ 0 }; Lane < 4; ++Lane) Lanes.Ray[Lane] = -1;
+	int Next{ 0 };
+
+	while (true) {
+		//finished lanes give their result and take the next ray w something to trace
+		int Busy{ 0 };
+		for (int Lane{ 0 }; Lane < 4; ++Lane) {
+			if (Lanes.Ray[Lane] >= 0 && (Lanes.Blocked[Lane] || Lanes.Remaining[Lane] == 0)) {
+				Out[Lanes.Ray[Lane]] = !Lanes.Blocked[Lane];
+				Lanes.Ray[Lane] = -1;
+				Lanes.Index[Lane] = 0;
+				Lanes.Remaining[Lane] = 0;
+				Lanes.Blocked[Lane] = 0;
+			}
+			while (Lanes.Ray[Lane] < 0 && Next < Count) {
+				const losPair& Pair{ Pairs[Next] };
+				assert(Pair.From.Row >= 0 && Pair.From.Row < Grid.grdRows() && Pair.From.Col >= 0 && Pair.From.Col < Cols);
+				assert(Pair.To.Row >= 0 && Pair.To.Row < Grid.grdRows() && Pair.To.Col >= 0 && Pair.To.Col < Cols);
+				if (!losLoadLane(Lanes, Lane, Pair, Next, Cols)) Out[Next] = true;
+				++Next;
+			}
+			Busy += Lanes.Ray[Lane] >= 0;
+		}
+		if (Busy == 0) return;
+
+		__m128i Index{ _mm_load_si128(reinterpret_cast<const __m128i*>(Lanes.Index)) };
+		const __m128i ColDelta{ _mm_load_si128(reinterpret_cast<const __m128i*>(Lanes.ColDelta)) };
+		const __m128i RowDelta{ _mm_load_si128(reinterpret_cast<const __m128i*>(Lanes.RowDelta)) };
+		__m128i Error{ _mm_load_si128(reinterpret_cast<const __m128i*>(Lanes.Error)) };
+		const __m128i TwiceRowCount{ _mm_load_si128(reinterpret_cast<const __m128i*>(Lanes.TwiceRowCount)) };
+		const __m128i TwiceColCount{ _mm_load_si128(reinterpret_cast<const __m128i*>(Lanes.TwiceColCount)) };
+		__m128i Remaining{ _mm_load_si128(reinterpret_cast<const __m128i*>(Lanes.Remaining)) };
+		__m128i Blocked{ _mm_load_si128(reinterpret_cast<const __m128i*>(Lanes.Blocked)) };
+		const __m128i Zero{ _mm_setzero_si128() };
+
+		//all 4 lanes step together (masks are all bits set / 0 per lane) until one of them is done
+		//stepping doesn't depend on the loaded cells (the loop stops as soon as a lane is blocked anyway),
+		//so the cpu can run ahead of the loads, like it does w the predicted branch in the one-ray version
+		while (true) {
+			const __m128i Active{ _mm_cmpgt_epi32(Remaining, Zero) };
+			const __m128i StepCol{ _mm_andnot_si128(_mm_cmplt_epi32(Error, Zero), Active) };
+			const __m128i StepRow{ _mm_andnot_si128(_mm_cmpgt_epi32(Error, Zero), Active) };
+			Index = _mm_add_epi32(Index, _mm_add_epi32(_mm_and_si128(StepCol, ColDelta), _mm_and_si128(StepRow, RowDelta)));
+			Error = _mm_add_epi32(Error, _mm_sub_epi32(_mm_and_si128(StepRow, TwiceColCount), _mm_and_si128(StepCol, TwiceRowCount)));
+			//a step mask is -1 per lane
+			Remaining = _mm_add_epi32(Remaining, _mm_add_epi32(StepCol, StepRow));
+
+			//SSE2 has no gather, so the 4 cells are loaded one by one
+			alignas(16) std::int32_t Indices[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(Indices), Index);
+			const __m128i Cell{ _mm_set_epi32(Cells[Indices[3]], Cells[Indices[2]], Cells[Indices[1]], Cells[Indices[0]]) };
+			//the arrival cell isn't checked
+			const __m128i Checked{ _mm_and_si128(Active, _mm_cmpgt_epi32(Remaining, Zero)) };
+			Blocked = _mm_or_si128(Blocked, _mm_andnot_si128(_mm_cmpgt_epi32(Cell, Zero), Checked));
+
+			const __m128i Done{ _mm_and_si128(Active, _mm_or_si128(Blocked, _mm_cmpeq_epi32(Remaining, Zero))) };
+			if (_mm_movemask_epi8(Done)) break;
+		}
+
+		_mm_store_si128(reinterpret_cast<__m128i*>(Lanes.Index), Index);
+		_mm_store_si128(reinterpret_cast<__m128i*>(Lanes.Error), Error);
+		_mm_store_si128(reinterpret_cast<__m128i*>(Lanes.Remaining), Remaining);
+		_mm_store_si128(reinterpret_cast<__m128i*>(Lanes.Blocked), Blocked);
+	}
+#else
+	for (int Ray{ 0 }; Ray < Count; ++Ray) Out[Ray] = losCanSee(Grid, Pairs[Ray].From, Pairs[Ray].To);
+#endif
+}
+
+namespace {
+	//never equal to a real pair, so queries that were never traced are always stale
+	constexpr losPair losUntraced{ { -1, -1 }, { -1, -1 } };
+
+	bool losSamePair(const losPair& A, const losPair& B) { return A.From == B.From && A.To == B.To; }
+}
+
+losQueries::losQueries(grdGrid2D<int>& Grid, int Count) : mGrid{ Grid } {
+	losResize(Count);
+}
+
+void losQueries::losResize(int Count) {
+	assert(Count >= 0);
+	std::unique_ptr<bool[]> Visible{ new bool[Count] {} };
+	std::copy_n(mVisible.get(), std::min(Count, losCount()), Visible.get());
+	mVisible = std::move(Visible);
+	mStaleVisible.reset(new bool[Count]);
+	mPairs.resize(Count, losUntraced);
+	mTracedPairs.resize(Count, losUntraced);
+}
+
+void losQueries::losSet(int Query, losCell From, losCell To) {
+	assert(Query >= 0 && Query < losCount());
+	mPairs[Query] = { From, To };
+}
+
+void losQueries::losSetCell(losCell Cell, int Value) {
+	mGrid(Cell.Row, Cell.Col) = Value;
+	losInvalidate(Cell);
+}
+
+void losQueries::losInvalidate(losCell Cell) {
+	if (mDirtyRow0 > mDirtyRow1) {
+		mDirtyRow0 = mDirtyRow1 = Cell.Row;
+		mDirtyCol0 = mDirtyCol1 = Cell.Col;
+		return;
+	}
+	mDirtyRow0 = std::min(mDirtyRow0, Cell.Row);
+	mDirtyRow1 = std::max(mDirtyRow1, Cell.Row);
+	mDirtyCol0 = std::min(mDirtyCol0, Cell.Col);
+	mDirtyCol1 = std::max(mDirtyCol1, Cell.Col);
+}
+
+void losQueries::losInvalidateAll() {
+	mAllDirty = true;
+}
+
+void losQueries::losUpdate() {
+	mStale.clear();
+	mStalePairs.clear();
+	for (int Query{ 0 }; Query < losCount(); ++Query) {
+		const losPair& Pair{ mPairs[Query] };
+		//a line never leaves the rectangle spanned by its endpoints
+		const bool Touched{
+			std::min(Pair.From.Row, Pair.To.Row) <= mDirtyRow1 && std::max(Pair.From.Row, Pair.To.Row) >= mDirtyRow0
+			&& std::min(Pair.From.Col, Pair.To.Col) <= mDirtyCol1 && std::max(Pair.From.Col, Pair.To.Col) >= mDirtyCol0 };
+		if (mAllDirty || Touched || !losSamePair(Pair, mTracedPairs[Query])) {
+			mStale.push_back(Query);
+			mStalePairs.push_back(Pair);
+		}
+	}
+
+	mTraced = static_cast<int>(mStale.size());
+	::losCanSee(mGrid, mStalePairs.data(), mTraced, mStaleVisible.get());
+	for (int Index{ 0 }; Index < mTraced; ++Index) {
+		mVisible[mStale[Index]] = mStaleVisible[Index];
+		mTracedPairs[mStale[Index]] = mStalePairs[Index];
+	}
+
+	mDirtyRow0 = mDirtyCol0 = 0;
+	mDirtyRow1 = mDirtyCol1 = -1;
+	mAllDirty = false;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "grdGrid2D.h"
+
+//line of sight over an integer grid (grdGrid2D<int>, eg. converted from a dnmcafGrid)
+// - cells w a value <= 0 block sight (same as blocked cells for pathfinding, see pthfPathfinder.h)
+// - the line goes from the center of From to the center of To, only cells in between are checked (the endpoints may be blocked)
+// - a line passing exactly through a corner slips between the two cells touching it
+struct losCell {
+	int Row;
+	int Col;
+
+	friend bool operator==(losCell A, losCell B) { return A.Row == B.Row && A.Col == B.Col; }
+	friend bool operator!=(losCell A, losCell B) { return !(A == B); }
+};
+
+struct losPair {
+	losCell From;
+	losCell To;
+};
+
+//one ray
+bool losCanSee(const grdGrid2D<int>& Grid, losCell From, losCell To);
+
+//many rays: traced 4 at a time in SSE2 lanes that all take a step together, a lane that's done takes the next ray right away
+//Out[i] - whether Pairs[i] can see each other
+void losCanSee(const grdGrid2D<int>& Grid, const losPair* Pairs, int Count, bool* Out);
+
+// - cached queries
+//a fixed set of queries (eg. one per enemy, towards the player), updated once per tick
+//a query is only traced again when one of its endpoints moved, or a cell inside its bounding box changed
+class losQueries {
+public:
+	explicit losQueries(grdGrid2D<int>& Grid, int Count = 0);
+
+	void losResize(int Count);
+	void losSet(int Query, losCell From, losCell To);
+
+	//changes a cell of the grid, and marks the queries around it for tracing
+	void losSetCell(losCell Cell, int Value);
+	//for when the grid was modified directly
+	void losInvalidate(losCell Cell);
+	void losInvalidateAll();
+
+	//traces everything that changed since the last update
+	void losUpdate();
+
+	bool losCanSee(int Query) const { return mVisible[Query]; }
+	//results of all queries, eg. as the CanSeePlayer column of dcsnColumns
+	const bool* losResults() const { return mVisible.get(); }
+	int losCount() const { return static_cast<int>(mPairs.size()); }
+	//rays traced by the last update
+	int losTraced() const { return mTraced; }
+
+private:
+	grdGrid2D<int>& mGrid;
+	std::vector<losPair> mPairs;
+	//pairs as of their last trace
+	std::vector<losPair> mTracedPairs;
+	std::unique_ptr<bool[]> mVisible;
+	//every cell changed since the last update is inside this rectangle (empty if Row0 > Row1)
+	int mDirtyRow0{ 0 };
+	int mDirtyCol0{ 0 };
+	int mDirtyRow1{ -1 };
+	int mDirtyCol1{ -1 };
+	bool mAllDirty{ true };
+	//scratch, reused every update
+	std::vector<int> mStale;
+	std::vector<losPair> mStalePairs;
+	std::unique_ptr<bool[]> mStaleVisible;
+	int mTraced{ 0 };
+};
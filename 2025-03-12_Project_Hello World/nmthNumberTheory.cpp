@@ -0,0 +1,183 @@
+#include "nmthNumberTheory.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace {
+	//floor(sqrt(N)), corrected for the rounding of the floating point version
+	std::uint64_t nmthSqrt(std::uint64_t N) {
+		std::uint64_t Root{ static_cast<std::uint64_t>(std::sqrt(static_cast<double>(N))) };
+		while (Root > 0 && Root * Root > N) --Root;
+		while ((Root + 1) * (Root + 1) <= N) ++Root;
+		return Root;
+	}
+
+	//every divisor is a product of each prime raised to 0..Exponent
+	//so we start from { 1 }, and for each prime append copies of what we have so far multiplied by p, p^2, ...
+	template <typename T>
+	int nmthExpandDivisors(const nmthFactor* Factors, int FactorCount, T* Out, int Capacity) {
+		int Total{ 1 };
+		for (int i{ 0 }; i < FactorCount; ++i) {
+			Total *= Factors[i].Exponent + 1;
+		}
+		if (Total > Capacity) return Total;
+
+		int Count{ 1 };
+		Out[0] = 1;
+		for (int i{ 0 }; i < FactorCount; ++i) {
+			const int Previous{ Count };
+			T Power{ 1 };
+			for (int Exponent{ 1 }; Exponent <= Factors[i].Exponent; ++Exponent) {
+				Power *= static_cast<T>(Factors[i].Prime);
+				for (int j{ 0 }; j < Previous; ++j) {
+					Out[Count++] = Out[j] * Power;
+				}
+			}
+		}
+		return Count;
+	}
+
+	//divides every Prime out of N, recording it in Out if it was a factor
+	template <typename T>
+	void nmthDivideOut(T& N, T Prime, nmthFactor* Out, int& Count) {
+		int Exponent{ 0 };
+		while (N % Prime == 0) {
+			N /= Prime;
+			++Exponent;
+		}
+		if (Exponent) Out[Count++] = { Prime, Exponent };
+	}
+}
+
+int nmthFactorize(std::uint32_t N, nmthFactor* Out) {
+	int Count{ 0 };
+	nmthDivideOut<std::uint32_t>(N, 2, Out, Count);
+	for (std::uint32_t Candidate{ 3 }; static_cast<std::uint64_t>(Candidate) * Candidate <= N; Candidate += 2) {
+		nmthDivideOut(N, Candidate, Out, Count);
+	}
+	if (N > 1) Out[Count++] = { N, 1 };
+	return Count;
+}
+
+int nmthDivisors(std::uint32_t N, std::uint32_t* Out, int Capacity) {
+	assert(N >= 1);
+	nmthFactor Factors[nmthMaxFactors];
+	const int FactorCount{ nmthFactorize(N, Factors) };
+	return nmthExpandDivisors(Factors, FactorCount, Out, Capacity);
+}
+
+//linear sieve - every composite is crossed out exactly once, by its smallest prime factor
+//(i * p is only marked for primes p up to the smallest factor of i, which makes p the smallest factor of i * p)
+nmthSieve::nmthSieve(std::uint32_t Limit) : mFactor(static_cast<std::size_t>(Limit) + 1, 0) {
+	std::vector<std::uint32_t> Primes;
+	for (std::uint64_t i{ 2 }; i <= Limit; ++i) {
+		const std::uint64_t Smallest{ mFactor[i] ? mFactor[i] : i };
+		if (!mFactor[i]) Primes.push_back(static_cast<std::uint32_t>(i));
+		for (std::uint32_t Prime : Primes) {
+			if (Prime > Smallest || i * Prime > Limit) break;
+			mFactor[i * Prime] = static_cast<std::uint16_t>(Prime);
+		}
+	}
+}
+
+int nmthSieve::nmthFactorize(std::uint32_t N, nmthFactor* Out) const {
+	assert(N <= nmthLimit());
+	int Count{ 0 };
+	while (N > 1) {
+		const std::uint32_t Prime{ nmthSmallestPrimeFactor(N) };
+		int Exponent{ 0 };
+		do {
+			N /= Prime;
+			++Exponent;
+		} while (N % Prime == 0);
+		Out[Count++] = { Prime, Exponent };
+	}
+	return Count;
+}
+
+int nmthSieve::nmthDivisors(std::uint32_t N, std::uint32_t* Out, int Capacity) const {
+	assert(N >= 1);
+	nmthFactor Factors[nmthMaxFactors];
+	const int FactorCount{ nmthFactorize(N, Factors) };
+	return nmthExpandDivisors(Factors, FactorCount, Out, Capacity);
+}
+
+nmthSegmentedSieve::nmthSegmentedSieve(std::uint64_t Low, std::uint32_t Size) : mLow{ Low }, mSize{ Size }, mFactor(Size) {
+	assert(Size > 0);
+	nmthSetWindow(Low);
+}
+
+void nmthSegmentedSieve::nmthSetWindow(std::uint64_t Low) {
+	mLow = Low;
+	const std::uint64_t High{ mLow + mSize };
+
+	//base primes only ever grow, as the window moves forwards
+	const std::uint64_t BaseLimit{ nmthSqrt(High - 1) };
+	if (BaseLimit > mBaseLimit) {
+		const nmthSieve Base{ static_cast<std::uint32_t>(BaseLimit) };
+		mBasePrimes.clear();
+		for (std::uint32_t N{ 2 }; N <= BaseLimit; ++N) {
+			if (Base.nmthIsPrime(N)) mBasePrimes.push_back(N);
+		}
+		mBaseLimit = BaseLimit;
+	}
+
+	//primes in ascending order, so the first one to reach a number is its smallest factor
+	std::fill(mFactor.begin(), mFactor.end(), 0);
+	for (std::uint32_t Prime : mBasePrimes) {
+		const std::uint64_t Square{ static_cast<std::uint64_t>(Prime) * Prime };
+		if (Square >= High) break;
+		std::uint64_t Multiple{ (mLow + Prime - 1) / Prime * Prime };
+		if (Multiple < Square) Multiple = Square;
+		for (; Multiple < High; Multiple += Prime) {
+			std::uint32_t& Factor{ mFactor[Multiple - mLow] };
+			if (!Factor) Factor = Prime;
+		}
+	}
+}
+
+std::uint64_t nmthSegmentedSieve::nmthSmallestPrimeFactor(std::uint64_t N) const {
+	assert(N >= mLow && N - mLow < mSize);
+	const std::uint32_t Factor{ mFactor[N - mLow] };
+	return Factor ? Factor : N;
+}
+
+//the window only knows the smallest factor, the rest of N comes from trial division by the base primes
+int nmthSegmentedSieve::nmthFactorize(std::uint64_t N, nmthFactor* Out) const {
+	int Count{ 0 };
+	if (N < 2) return 0;
+	const std::uint64_t Smallest{ nmthSmallestPrimeFactor(N) };
+	nmthDivideOut(N, Smallest, Out, Count);
+	for (std::uint32_t Prime : mBasePrimes) {
+		if (Prime <= Smallest) continue;
+		if (static_cast<std::uint64_t>(Prime) * Prime > N) break;
+		nmthDivideOut<std::uint64_t>(N, Prime, Out, Count);
+	}
+	if (N > 1) Out[Count++] = { N, 1 };
+	return Count;
+}
+
+int nmthSegmentedSieve::nmthDivisors(std::uint64_t N, std::uint64_t* Out, int Capacity) const {
+	assert(N >= 1);
+	nmthFactor Factors[nmthMaxFactors];
+	const int FactorCount{ nmthFactorize(N, Factors) };
+	return nmthExpandDivisors(Factors, FactorCount, Out, Capacity);
+}
+
+void nmthIsEven(const std::int32_t* Values, int Count, std::uint8_t* Out) {
+	for (int i{ 0 }; i < Count; ++i) {
+		Out[i] = static_cast<std::uint8_t>(~Values[i] & 1);
+	}
+}
+
+void nmthIsDivisibleBy(const std::uint32_t* Values, int Count, std::uint32_t Divisor, std::uint8_t* Out) {
+	if (Divisor == 0) {
+		for (int i{ 0 }; i < Count; ++i) Out[i] = 0;
+		return;
+	}
+	//wraps to 0 for Divisor 1, which still works out: M - 1 is then the largest 64-bit value
+	const std::uint64_t M{ UINT64_MAX / Divisor + 1 };
+	for (int i{ 0 }; i < Count; ++i) {
+		Out[i] = static_cast<std::uint8_t>(Values[i] * M <= M - 1);
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+//number theory helpers for loot tables, wave scheduling, etc. - divisors, prime factors, batch divisibility checks
+//divisors are written into a buffer supplied by the caller (no allocation per query), and come out unsorted
+
+//no 32-bit number has more divisors than this (3491888400 has 1920, the most for an int is 1600 - 2095133040), so a buffer of this size always fits
+constexpr int nmthMaxDivisors32{ 1920 };
+//no 64-bit number has more distinct prime factors than this (2 * 3 * 5 * ... * 47), so nmthFactorize's Out needs at most this many
+constexpr int nmthMaxFactors{ 15 };
+
+struct nmthFactor {
+	std::uint64_t Prime;
+	int Exponent;
+};
+
+// - one-off queries
+//trial division up to sqrt(N), fine for the odd number, for many numbers use nmthSieve
+int nmthFactorize(std::uint32_t N, nmthFactor* Out);
+//returns the number of divisors of N (N >= 1), they're only written if that's no more than Capacity
+//(so a count above Capacity means Out was left untouched)
+int nmthDivisors(std::uint32_t N, std::uint32_t* Out, int Capacity);
+
+// - smallest-prime-factor sieve over [0, Limit]
+//once built, factorizing any N <= Limit takes one lookup per prime factor
+//composite numbers below 2^32 always have a factor below 2^16, so factors are stored in 16 bits (0 marks a prime)
+//(10^7 numbers take ~20MB)
+class nmthSieve {
+public:
+	explicit nmthSieve(std::uint32_t Limit);
+
+	std::uint32_t nmthLimit() const { return static_cast<std::uint32_t>(mFactor.size() - 1); }
+	//N itself if N is prime (N >= 2)
+	std::uint32_t nmthSmallestPrimeFactor(std::uint32_t N) const { return mFactor[N] ? mFactor[N] : N; }
+	bool nmthIsPrime(std::uint32_t N) const { return N >= 2 && mFactor[N] == 0; }
+
+	int nmthFactorize(std::uint32_t N, nmthFactor* Out) const;
+	int nmthDivisors(std::uint32_t N, std::uint32_t* Out, int Capacity) const;
+
+private:
+	std::vector<std::uint16_t> mFactor;
+};
+
+// - segmented sieve
+//same as nmthSieve, but over a window [Low, Low + Size) that can be anywhere (eg. around 10^12), and slid forwards
+//memory only grows w Size and sqrt(Low + Size), rather than w the numbers themselves
+class nmthSegmentedSieve {
+public:
+	nmthSegmentedSieve(std::uint64_t Low, std::uint32_t Size);
+
+	void nmthSetWindow(std::uint64_t Low);
+	void nmthNextWindow() { nmthSetWindow(mLow + mSize); }
+	std::uint64_t nmthLow() const { return mLow; }
+	std::uint32_t nmthSize() const { return mSize; }
+
+	//N must be inside the current window
+	std::uint64_t nmthSmallestPrimeFactor(std::uint64_t N) const;
+	bool nmthIsPrime(std::uint64_t N) const { return N >= 2 && nmthSmallestPrimeFactor(N) == N; }
+	int nmthFactorize(std::uint64_t N, nmthFactor* Out) const;
+	int nmthDivisors(std::uint64_t N, std::uint64_t* Out, int Capacity) const;
+
+private:
+	std::uint64_t mLow;
+	std::uint32_t mSize;
+	//all primes up to sqrt of the end of the window
+	std::vector<std::uint32_t> mBasePrimes;
+	std::uint64_t mBaseLimit{ 0 };
+	//smallest prime factor of mLow + i, 0 for primes
+	std::vector<std::uint32_t> mFactor;
+};
+
+// - batch predicates
+//Out[i] = 1 if the predicate holds for Values[i], 0 otherwise
+//both are branch-free loops the compiler can vectorize
+void nmthIsEven(const std::int32_t* Values, int Count, std::uint8_t* Out);
+//checks divisibility w/out dividing: for M = ceil(2^64 / Divisor), N is divisible exactly when N * M (wrapping) <= M - 1
+void nmthIsDivisibleBy(const std::uint32_t* Values, int Count, std::uint32_t Divisor, std::uint8_t* Out);
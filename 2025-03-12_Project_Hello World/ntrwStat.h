@@ -0,0 +1,84 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+//storage policy for stats (health, level, ...) - each stat declares its range, and gets the narrowest integer that can hold it
+//in bulk (eg. a column of health values for every entity) a 16-bit stat moves half the memory of an int
+//reading a stat widens it to Wide (eg. usnginteger), so all arithmetic happens at full width, and only storing narrows it again
+template <std::int64_t MinValue, std::int64_t MaxValue>
+struct ntrwStorageFor {
+	static_assert(MinValue <= MaxValue, "stat range is empty");
+
+	template <typename Candidate>
+	static constexpr bool ntrwFits{
+		MinValue >= std::numeric_limits<Candidate>::min() && MaxValue <= std::numeric_limits<Candidate>::max()
+	};
+
+	using Type = std::conditional_t<ntrwFits<std::int16_t>, std::int16_t,
+		std::conditional_t<ntrwFits<std::int32_t>, std::int32_t, std::int64_t>>;
+};
+
+template <std::int64_t MinValue, std::int64_t MaxValue, typename Wide = std::int64_t>
+class ntrwStat {
+public:
+	using ntrwStorage = typename ntrwStorageFor<MinValue, MaxValue>::Type;
+	using ntrwWide = Wide;
+
+	static_assert(std::is_integral_v<Wide> && std::is_signed_v<Wide>, "stats widen to a signed integer");
+	static_assert(MinValue >= std::numeric_limits<Wide>::min() && MaxValue <= std::numeric_limits<Wide>::max(),
+		"stat range doesn't fit in the type it widens to");
+
+	static constexpr Wide ntrwMin{ static_cast<Wide>(MinValue) };
+	static constexpr Wide ntrwMax{ static_cast<Wide>(MaxValue) };
+
+	constexpr ntrwStat() : mValue{ static_cast<ntrwStorage>(MinValue) } {}
+	//values known at run time: out of range is a bug (asserted in debug builds), release builds clamp rather than truncate
+	//(explicit, so narrowing a Wide into a stat is always visible at the call site)
+	explicit constexpr ntrwStat(Wide Value) : ntrwStat{ ntrwUnchecked{}, ntrwClamp(Value) } {
+		assert(Value >= ntrwMin && Value <= ntrwMax);
+	}
+
+	//values known at compile time are range checked at compile time
+	template <std::int64_t Value>
+	static constexpr ntrwStat ntrwConstant() {
+		static_assert(Value >= MinValue && Value <= MaxValue, "constant is outside of the stat's declared range");
+		return ntrwStat{ ntrwUnchecked{}, static_cast<Wide>(Value) };
+	}
+
+	//for when going out of range is expected (eg. damage below 0 health)
+	static constexpr ntrwStat ntrwClamped(Wide Value) {
+		return ntrwStat{ ntrwUnchecked{}, ntrwClamp(Value) };
+	}
+
+	constexpr Wide ntrwGet() const { return mValue; }
+	//implicit, so "Health - Damage", "Health * 2" etc. are evaluated as Wide
+	constexpr operator Wide() const { return mValue; }
+
+	//compound assignments work at full width, then clamp back into the range
+	constexpr ntrwStat& operator+=(Wide Amount) { return *this = ntrwClamped(ntrwGet() + Amount); }
+	constexpr ntrwStat& operator-=(Wide Amount) { return *this = ntrwClamped(ntrwGet() - Amount); }
+
+private:
+	struct ntrwUnchecked {};
+	constexpr ntrwStat(ntrwUnchecked, Wide Value) : mValue{ static_cast<ntrwStorage>(Value) } {}
+	static constexpr Wide ntrwClamp(Wide Value) { return Value < ntrwMin ? ntrwMin : Value > ntrwMax ? ntrwMax : Value; }
+
+	ntrwStorage mValue;
+};
+
+//column of one stat for many entities - stored at the narrow width
+template <std::int64_t MinValue, std::int64_t MaxValue, typename Wide = std::int64_t>
+using ntrwColumn = std::vector<ntrwStat<MinValue, MaxValue, Wide>>;
+
+//summing a column in the wide type, no overflow for as long as the total fits in Wide
+template <std::int64_t MinValue, std::int64_t MaxValue, typename Wide>
+Wide ntrwSum(const ntrwColumn<MinValue, MaxValue, Wide>& Column) {
+	Wide Total{ 0 };
+	for (const auto& Value : Column) {
+		Total += Value.ntrwGet();
+	}
+	return Total;
+}
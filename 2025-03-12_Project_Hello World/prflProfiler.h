@@ -0,0 +1,277 @@
+#pragma once
+//scoped profiling zones and counters, only compiled in when DEVELOPMENT_BUILD is defined
+//(the flag has to be defined before this header is included)
+//
+//	void UpdateEnemies() {
+//		PROFILE_ZONE("UpdateEnemies");
+//		PROFILE_COUNTER("Enemies", EnemyCount);
+//		...
+//	}
+//	PROFILE_FRAME();				- once per frame, collects everything recorded since the previous one
+//	PROFILE_LOG_FRAME(std::cout);	- count, total and max per zone for the last collected frame
+//
+//w/out DEVELOPMENT_BUILD all the macros expand to nothing, so the released code doesn't even contain the zone names
+
+#ifdef DEVELOPMENT_BUILD
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define PRFL_HAS_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PRFL_HAS_RDTSC 1
+#else
+#define PRFL_HAS_RDTSC 0
+#endif
+
+//one per PROFILE_ZONE / PROFILE_COUNTER in the code, events refer to it by address
+struct prflSite {
+	const char* Name;
+	bool IsCounter;
+};
+
+//zone: Begin/End are timestamps, counter: Begin is the value
+struct prflEvent {
+	const prflSite* Site;
+	std::uint64_t Begin;
+	std::uint64_t End;
+};
+
+inline std::uint64_t prflNow() {
+#if PRFL_HAS_RDTSC
+	return __rdtsc();
+#else
+	return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+//ring of events written only by its own thread and read only by PROFILE_FRAME (single producer, single consumer)
+//so recording a zone is a couple of plain stores + one release store, no locks
+class prflThreadBuffer {
+public:
+	static constexpr std::uint32_t prflCapacity{ 1 << 14 };
+
+	void prflPush(const prflSite* Site, std::uint64_t Begin, std::uint64_t End) {
+		const std::uint32_t Write{ mWrite.load(std::memory_order_relaxed) };
+		//the reader's position is only re-checked when the ring looks full, so the common case doesn't touch its cache line
+		if (Write - mCachedRead == prflCapacity) {
+			mCachedRead = mRead.load(std::memory_order_acquire);
+			if (Write - mCachedRead == prflCapacity) {
+				//full - the frame is too long or PROFILE_FRAME isn't being called
+				mDropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+		}
+		mEvents[Write % prflCapacity] = { Site, Begin, End };
+		mWrite.store(Write + 1, std::memory_order_release);
+	}
+
+	template <typename Callable>
+	void prflDrain(Callable Consume) {
+		const std::uint32_t Write{ mWrite.load(std::memory_order_acquire) };
+		std::uint32_t Read{ mRead.load(std::memory_order_relaxed) };
+		for (; Read != Write; ++Read) {
+			Consume(mEvents[Read % prflCapacity]);
+		}
+		mRead.store(Read, std::memory_order_release);
+	}
+
+	std::uint32_t prflTakeDropped() { return mDropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+	std::unique_ptr<prflEvent[]> mEvents{ new prflEvent[prflCapacity] };
+	std::atomic<std::uint32_t> mWrite{ 0 };
+	std::atomic<std::uint32_t> mRead{ 0 };
+	//producer's copy of mRead
+	std::uint32_t mCachedRead{ 0 };
+	std::atomic<std::uint32_t> mDropped{ 0 };
+};
+
+//every thread's buffer, so PROFILE_FRAME can find them
+//buffers are shared w the registry, so events from threads that already finished are still collected
+struct prflRegistry {
+	std::mutex Lock;
+	std::vector<std::shared_ptr<prflThreadBuffer>> Buffers;
+};
+
+inline prflRegistry& prflGetRegistry() {
+	static prflRegistry Registry;
+	return Registry;
+}
+
+//the lock is only taken the first time each thread records something
+inline prflThreadBuffer* prflRegisterThread() {
+	auto NewBuffer{ std::make_shared<prflThreadBuffer>() };
+	prflRegistry& Registry{ prflGetRegistry() };
+	std::lock_guard<std::mutex> Guard{ Registry.Lock };
+	Registry.Buffers.push_back(NewBuffer);
+	return NewBuffer.get();
+}
+
+//the registry owns the buffers, each thread only keeps a plain pointer to its own
+//(a thread_local w/out a constructor is a single load - a thread_local std::shared_ptr checks its initialization guard on every zone)
+inline prflThreadBuffer& prflGetThreadBuffer() {
+	thread_local prflThreadBuffer* Buffer{ nullptr };
+	if (!Buffer) Buffer = prflRegisterThread();
+	return *Buffer;
+}
+
+class prflScope {
+public:
+	explicit prflScope(const prflSite* Site)
+		: mSite{ Site }, mBuffer{ prflGetThreadBuffer() }, mBegin{ prflNow() } {}
+	~prflScope() {
+		mBuffer.prflPush(mSite, mBegin, prflNow());
+	}
+	prflScope(const prflScope&) = delete;
+	prflScope& operator=(const prflScope&) = delete;
+
+private:
+	const prflSite* mSite;
+	prflThreadBuffer& mBuffer;
+	std::uint64_t mBegin;
+};
+
+inline void prflCount(const prflSite* Site, std::uint64_t Value) {
+	prflGetThreadBuffer().prflPush(Site, Value, 0);
+}
+
+//zone times are totals across all threads, and include the time spent in nested zones
+struct prflZoneStats {
+	const char* Name;
+	bool IsCounter;
+	std::uint64_t Count;
+	std::uint64_t Total;
+	std::uint64_t Max;
+};
+
+struct prflFrame {
+	std::vector<prflZoneStats> Zones;
+	std::uint64_t Dropped{ 0 };
+};
+
+//rdtsc counts at a fixed rate, which we measure once against steady_clock
+inline double prflTicksPerNanosecond() {
+#if PRFL_HAS_RDTSC
+	static const double TicksPerNanosecond{ [] {
+		const auto StartTime{ std::chrono::steady_clock::now() };
+		const std::uint64_t StartTicks{ prflNow() };
+		while (std::chrono::steady_clock::now() - StartTime < std::chrono::milliseconds{ 5 }) {}
+		const std::uint64_t Ticks{ prflNow() - StartTicks };
+		const auto Elapsed{ std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - StartTime) };
+		return static_cast<double>(Ticks) / static_cast<double>(Elapsed.count());
+	}() };
+	return TicksPerNanosecond;
+#else
+	using prflPeriod = std::chrono::steady_clock::period;
+	return static_cast<double>(prflPeriod::den) / (static_cast<double>(prflPeriod::num) * 1e9);
+#endif
+}
+
+class prflCollector {
+public:
+	//meant to be called from one thread (the one running the frame loop)
+	void prflEndFrame() {
+		std::lock_guard<std::mutex> Guard{ mLock };
+		for (auto& [Site, Stats] : mStats) {
+			Stats.Count = Stats.Total = Stats.Max = 0;
+		}
+		mFrame.Dropped = 0;
+
+		std::vector<std::shared_ptr<prflThreadBuffer>> Buffers;
+		{
+			prflRegistry& Registry{ prflGetRegistry() };
+			std::lock_guard<std::mutex> RegistryGuard{ Registry.Lock };
+			Buffers = Registry.Buffers;
+		}
+		for (const auto& Buffer : Buffers) {
+			//events of a zone in a loop come one after another, so the lookup is only repeated when the site changes
+			const prflSite* LastSite{ nullptr };
+			prflZoneStats* LastStats{ nullptr };
+			Buffer->prflDrain([&](const prflEvent& Event) {
+				if (Event.Site != LastSite) {
+					LastSite = Event.Site;
+					LastStats = &mStats[Event.Site];
+				}
+				prflZoneStats& Stats{ *LastStats };
+				const std::uint64_t Value{ Event.Site->IsCounter ? Event.Begin : Event.End - Event.Begin };
+				++Stats.Count;
+				Stats.Total += Value;
+				Stats.Max = std::max(Stats.Max, Value);
+			});
+			mFrame.Dropped += Buffer->prflTakeDropped();
+		}
+
+		mFrame.Zones.clear();
+		for (auto& [Site, Stats] : mStats) {
+			if (Stats.Count == 0) continue;
+			mFrame.Zones.push_back({ Site->Name, Site->IsCounter, Stats.Count, Stats.Total, Stats.Max });
+		}
+		std::sort(mFrame.Zones.begin(), mFrame.Zones.end(), [](const prflZoneStats& A, const prflZoneStats& B) {
+			return A.IsCounter != B.IsCounter ? B.IsCounter : A.Total > B.Total;
+		});
+	}
+
+	const prflFrame& prflLastFrame() const { return mFrame; }
+
+	void prflLogFrame(std::ostream& Stream) const {
+		const double TicksPerNanosecond{ prflTicksPerNanosecond() };
+		Stream << "\n-- frame profile --";
+		for (const prflZoneStats& Zone : mFrame.Zones) {
+			Stream << '\n' << Zone.Name << ": " << Zone.Count << "x";
+			if (Zone.IsCounter) {
+				Stream << ", total " << Zone.Total << ", max " << Zone.Max;
+			}
+			else {
+				Stream << ", total " << static_cast<std::uint64_t>(Zone.Total / TicksPerNanosecond) << "ns"
+					<< ", max " << static_cast<std::uint64_t>(Zone.Max / TicksPerNanosecond) << "ns";
+			}
+		}
+		if (mFrame.Dropped) Stream << "\n(" << mFrame.Dropped << " events dropped)";
+	}
+
+private:
+	std::mutex mLock;
+	std::unordered_map<const prflSite*, prflZoneStats> mStats;
+	prflFrame mFrame;
+};
+
+inline prflCollector& prflGetCollector() {
+	static prflCollector Collector;
+	return Collector;
+}
+
+#define PRFL_CONCAT_INNER(A, B) A##B
+#define PRFL_CONCAT(A, B) PRFL_CONCAT_INNER(A, B)
+
+#define PROFILE_ZONE(Name)																\
+	static const prflSite PRFL_CONCAT(prflZoneSite, __LINE__){ Name, false };			\
+	prflScope PRFL_CONCAT(prflZoneScope, __LINE__){ &PRFL_CONCAT(prflZoneSite, __LINE__) }
+
+#define PROFILE_COUNTER(Name, Value)													\
+	do {																				\
+		static const prflSite prflCounterSite{ Name, true };							\
+		prflCount(&prflCounterSite, static_cast<std::uint64_t>(Value));					\
+	} while (false)
+
+#define PROFILE_FRAME() prflGetCollector().prflEndFrame()
+#define PROFILE_LOG_FRAME(Stream) prflGetCollector().prflLogFrame(Stream)
+
+#else
+
+#define PROFILE_ZONE(Name)
+#define PROFILE_COUNTER(Name, Value) do {} while (false)
+#define PROFILE_FRAME() do {} while (false)
+#define PROFILE_LOG_FRAME(Stream) do {} while (false)
+
+#endif
@@ -0,0 +1,250 @@
+#include "pthfPathfinder.h"
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+
+namespace {
+	constexpr int pthfRowSteps[4]{ -1, 1, 0, 0 };
+	constexpr int pthfColSteps[4]{ 0, 0, -1, 1 };
+	constexpr std::uint32_t pthfNone{ 0xFFFFFFFF };
+
+	//(priority, cell index) - std::greater turns the std heap functions into a min-heap
+	using pthfOpenNode = std::pair<int, std::uint32_t>;
+
+	struct pthfNodePool {
+		std::vector<int> Cost;
+		std::vector<std::uint32_t> Parent;
+		//a node belongs to the current query only if its Stamp matches Generation, so nothing is cleared between queries
+		std::vector<std::uint32_t> Stamp;
+		std::uint32_t Generation{ 0 };
+		std::vector<pthfOpenNode> Open;
+
+		void pthfBegin(std::size_t Cells) {
+			if (Stamp.size() < Cells) {
+				Cost.resize(Cells);
+				Parent.resize(Cells);
+				Stamp.resize(Cells, 0);
+			}
+			if (++Generation == 0) {
+				std::fill(Stamp.begin(), Stamp.end(), 0);
+				Generation = 1;
+			}
+			Open.clear();
+		}
+		bool pthfIsVisited(std::uint32_t Index) const { return Stamp[Index] == Generation; }
+		void pthfVisit(std::uint32_t Index, int NodeCost, std::uint32_t NodeParent) {
+			Stamp[Index] = Generation;
+			Cost[Index] = NodeCost;
+			Parent[Index] = NodeParent;
+		}
+		void pthfPush(int Priority, std::uint32_t Index) {
+			Open.emplace_back(Priority, Index);
+			std::push_heap(Open.begin(), Open.end(), std::greater<pthfOpenNode>{});
+		}
+		pthfOpenNode pthfPop() {
+			std::pop_heap(Open.begin(), Open.end(), std::greater<pthfOpenNode>{});
+			pthfOpenNode Top{ Open.back() };
+			Open.pop_back();
+			return Top;
+		}
+	};
+
+	thread_local pthfNodePool pthfPool;
+
+	bool pthfIsWalkable(const grdGrid2D<int>& Costs, int Row, int Col) {
+		return Row >= 0 && Row < Costs.grdRows() && Col >= 0 && Col < Costs.grdCols() && Costs(Row, Col) > 0;
+	}
+}
+
+bool pthfFindPath(const grdGrid2D<int>& Costs, pthfCell Start, pthfCell Goal, std::vector<pthfCell>& OutPath) {
+	OutPath.clear();
+	if (!pthfIsWalkable(Costs, Start.Row, Start.Col) || !pthfIsWalkable(Costs, Goal.Row, Goal.Col)) {
+		return false;
+	}
+
+	const int Cols{ Costs.grdCols() };
+	//every step costs at least 1, so Manhattan distance never overestimates
+	auto Heuristic{ [&](int Row, int Col) {
+		return std::abs(Row - Goal.Row) + std::abs(Col - Goal.Col);
+	} };
+
+	pthfNodePool& Pool{ pthfPool };
+	Pool.pthfBegin(static_cast<std::size_t>(Costs.grdRows()) * Cols);
+	const std::uint32_t StartIndex{ static_cast<std::uint32_t>(Start.Row * Cols + Start.Col) };
+	const std::uint32_t GoalIndex{ static_cast<std::uint32_t>(Goal.Row * Cols + Goal.Col) };
+	Pool.pthfVisit(StartIndex, 0, pthfNone);
+	Pool.pthfPush(Heuristic(Start.Row, Start.Col), StartIndex);
+
+	while (!Pool.Open.empty()) {
+		auto [Priority, Index]{ Pool.pthfPop() };
+		const int Row{ static_cast<int>(Index) / Cols };
+		const int Col{ static_cast<int>(Index) % Cols };
+		//stale heap entry - this node was reached more cheaply after being pushed
+		if (Priority > Pool.Cost[Index] + Heuristic(Row, Col)) continue;
+
+		if (Index == GoalIndex) {
+			for (std::uint32_t Step{ GoalIndex }; Step != pthfNone; Step = Pool.Parent[Step]) {
+				OutPath.push_back({ static_cast<int>(Step) / Cols, static_cast<int>(Step) % Cols });
+			}
+			std::reverse(OutPath.begin(), OutPath.end());
+			return true;
+		}
+
+		for (int Direction{ 0 }; Direction < 4; ++Direction) {
+			const int NextRow{ Row + pthfRowSteps[Direction] };
+			const int NextCol{ Col + pthfColSteps[Direction] };
+			if (!pthfIsWalkable(Costs, NextRow, NextCol)) continue;
+			const std::uint32_t Next{ static_cast<std::uint32_t>(NextRow * Cols + NextCol) };
+			const int NextCost{ Pool.Cost[Index] + Costs(NextRow, NextCol) };
+			if (Pool.pthfIsVisited(Next) && Pool.Cost[Next] <= NextCost) continue;
+			Pool.pthfVisit(Next, NextCost, Index);
+			Pool.pthfPush(NextCost + Heuristic(NextRow, NextCol), Next);
+		}
+	}
+	return false;
+}
+
+void pthfFlowField::pthfBuild(const grdGrid2D<int>& Costs, pthfCell Goal) {
+	const int Rows{ Costs.grdRows() };
+	const int Cols{ Costs.grdCols() };
+	mGoal = Goal;
+	if (mDistance.grdRows() != Rows || mDistance.grdCols() != Cols) {
+		mDistance = grdGrid2D<int>{ Rows, Cols };
+		mDirection = grdGrid2D<std::uint8_t>{ Rows, Cols };
+	}
+	mDistance.grdFill(-1);
+	mDirection.grdFill(4);
+	if (!pthfIsWalkable(Costs, Goal.Row, Goal.Col)) return;
+
+	//Dijkstra outwards from the goal - reaching A from B means A's next step is B, costing Costs(B)
+	std::vector<pthfOpenNode> Open;
+	Open.reserve(static_cast<std::size_t>(Rows) * Cols / 4);
+	mDistance(Goal.Row, Goal.Col) = 0;
+	Open.emplace_back(0, static_cast<std::uint32_t>(Goal.Row * Cols + Goal.Col));
+
+	while (!Open.empty()) {
+		std::pop_heap(Open.begin(), Open.end(), std::greater<pthfOpenNode>{});
+		auto [Distance, Index]{ Open.back() };
+		Open.pop_back();
+		const int Row{ static_cast<int>(Index) / Cols };
+		const int Col{ static_cast<int>(Index) % Cols };
+		if (Distance > mDistance(Row, Col)) continue;
+
+		const int StepCost{ Costs(Row, Col) };
+		for (int Direction{ 0 }; Direction < 4; ++Direction) {
+			const int PreviousRow{ Row + pthfRowSteps[Direction] };
+			const int PreviousCol{ Col + pthfColSteps[Direction] };
+			if (!pthfIsWalkable(Costs, PreviousRow, PreviousCol)) continue;
+			const int PreviousDistance{ Distance + StepCost };
+			int& Known{ mDistance(PreviousRow, PreviousCol) };
+			if (Known >= 0 && Known <= PreviousDistance) continue;
+			Known = PreviousDistance;
+			//stepping back the opposite way (directions are stored in pairs: up/down, left/right)
+			mDirection(PreviousRow, PreviousCol) = static_cast<std::uint8_t>(Direction ^ 1);
+			Open.emplace_back(PreviousDistance, static_cast<std::uint32_t>(PreviousRow * Cols + PreviousCol));
+			std::push_heap(Open.begin(), Open.end(), std::greater<pthfOpenNode>{});
+		}
+	}
+}
+
+bool pthfFlowField::pthfIsReachable(pthfCell From) const {
+	return pthfDistance(From) >= 0;
+}
+
+int pthfFlowField::pthfDistance(pthfCell From) const {
+	if (From.Row < 0 || From.Row >= mDistance.grdRows() || From.Col < 0 || From.Col >= mDistance.grdCols()) {
+		return -1;
+	}
+	return mDistance(From.Row, From.Col);
+}
+
+pthfCell pthfFlowField::pthfNext(pthfCell From) const {
+	if (!pthfIsReachable(From) || From == mGoal) return From;
+	const int Direction{ mDirection(From.Row, From.Col) };
+	return { From.Row + pthfRowSteps[Direction], From.Col + pthfColSteps[Direction] };
+}
+
+pthfPathCache::pthfPathCache(grdGrid2D<int>& Costs, int RegionSize)
+	: mCosts{ Costs },
+	mRegionSize{ RegionSize < 1 ? 1 : RegionSize },
+	mRegionCols{ (Costs.grdCols() + mRegionSize - 1) / mRegionSize } {
+	const int RegionRows{ (Costs.grdRows() + mRegionSize - 1) / mRegionSize };
+	mRegionPaths.resize(static_cast<std::size_t>(RegionRows) * mRegionCols);
+}
+
+std::uint64_t pthfPathCache::pthfKey(pthfCell Start, pthfCell Goal) const {
+	const std::uint64_t Cols{ static_cast<std::uint64_t>(mCosts.grdCols()) };
+	return ((Start.Row * Cols + Start.Col) << 32) | (Goal.Row * Cols + Goal.Col);
+}
+
+int pthfPathCache::pthfRegion(pthfCell Cell) const {
+	return (Cell.Row / mRegionSize) * mRegionCols + Cell.Col / mRegionSize;
+}
+
+const std::vector<pthfCell>* pthfPathCache::pthfFind(pthfCell Start, pthfCell Goal) {
+	const std::uint64_t Key{ pthfKey(Start, Goal) };
+	auto Found{ mPaths.find(Key) };
+	if (Found == mPaths.end()) {
+		pthfEntry Entry;
+		Entry.Found = pthfFindPath(mCosts, Start, Goal, Entry.Path);
+		if (Entry.Found) {
+			for (pthfCell Cell : Entry.Path) {
+				const int Region{ pthfRegion(Cell) };
+				if (Entry.Regions.empty() || Entry.Regions.back() != Region) Entry.Regions.push_back(Region);
+			}
+			//a path can leave a region and come back to it later
+			std::sort(Entry.Regions.begin(), Entry.Regions.end());
+			Entry.Regions.erase(std::unique(Entry.Regions.begin(), Entry.Regions.end()), Entry.Regions.end());
+			for (int Region : Entry.Regions) {
+				mRegionPaths[Region].push_back(Key);
+			}
+		}
+		else {
+			mNotFound.push_back(Key);
+		}
+		Found = mPaths.emplace(Key, std::move(Entry)).first;
+	}
+	return Found->second.Found ? &Found->second.Path : nullptr;
+}
+
+void pthfPathCache::pthfSetCost(pthfCell Cell, int Cost) {
+	mCosts(Cell.Row, Cell.Col) = Cost;
+	pthfInvalidate(Cell);
+}
+
+void pthfPathCache::pthfInvalidate(pthfCell Cell) {
+	const int Region{ pthfRegion(Cell) };
+	//taken out first, so dropping a path doesn't modify the list we're going through
+	std::vector<std::uint64_t> Paths;
+	Paths.swap(mRegionPaths[Region]);
+	for (std::uint64_t Key : Paths) {
+		pthfDrop(Key, Region);
+	}
+	for (std::uint64_t Key : mNotFound) {
+		mPaths.erase(Key);
+	}
+	mNotFound.clear();
+}
+
+void pthfPathCache::pthfDrop(std::uint64_t Key, int Skip) {
+	const auto Found{ mPaths.find(Key) };
+	if (Found == mPaths.end()) return;
+	for (int Region : Found->second.Regions) {
+		if (Region == Skip) continue;
+		std::vector<std::uint64_t>& Paths{ mRegionPaths[Region] };
+		const auto Position{ std::find(Paths.begin(), Paths.end(), Key) };
+		if (Position != Paths.end()) {
+			*Position = Paths.back();
+			Paths.pop_back();
+		}
+	}
+	mPaths.erase(Found);
+}
+
+void pthfPathCache::pthfClear() {
+	mPaths.clear();
+	for (std::vector<std::uint64_t>& Paths : mRegionPaths) {
+		Paths.clear();
+	}
+	mNotFound.clear();
+}
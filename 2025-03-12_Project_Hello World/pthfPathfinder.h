@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "grdGrid2D.h"
+
+//pathfinding over an integer cost grid (grdGrid2D<int>, eg. converted from a dnmcafGrid)
+// - value of a cell is the cost of entering it, cells w a value <= 0 are blocked
+// - movement is 4-directional
+struct pthfCell {
+	int Row;
+	int Col;
+
+	friend bool operator==(pthfCell A, pthfCell B) { return A.Row == B.Row && A.Col == B.Col; }
+	friend bool operator!=(pthfCell A, pthfCell B) { return !(A == B); }
+};
+
+// - A*
+//open list is a binary heap, and all per-node bookkeeping lives in a per-thread pool that is reused between queries
+//(so after the first query on a given map size, finding a path doesn't allocate, apart from growing OutPath)
+//OutPath receives Start..Goal inclusive, returns false (and leaves OutPath empty) if there is no path
+bool pthfFindPath(const grdGrid2D<int>& Costs, pthfCell Start, pthfCell Goal, std::vector<pthfCell>& OutPath);
+
+// - flow field
+//for many agents heading to the same goal - one pass computes, for every cell, which neighbour to step to next
+class pthfFlowField {
+public:
+	void pthfBuild(const grdGrid2D<int>& Costs, pthfCell Goal);
+
+	bool pthfIsReachable(pthfCell From) const;
+	//total cost from From to the goal (-1 if unreachable)
+	int pthfDistance(pthfCell From) const;
+	//next cell on the way to the goal (From itself at the goal, or if the goal is unreachable)
+	pthfCell pthfNext(pthfCell From) const;
+
+private:
+	pthfCell mGoal{ 0, 0 };
+	grdGrid2D<int> mDistance;
+	grdGrid2D<std::uint8_t> mDirection;
+};
+
+// - path cache
+//remembers A* results per (Start, Goal) pair
+//the grid is split into square regions, and every cached path knows which regions it passes through
+//when a cell changes, only paths through that cell's region are dropped (along w any cached "no path" results)
+//note: remaining paths stay valid, but a change elsewhere may have made a cheaper path possible
+class pthfPathCache {
+public:
+	pthfPathCache(grdGrid2D<int>& Costs, int RegionSize = 32);
+
+	//nullptr if there is no path
+	const std::vector<pthfCell>* pthfFind(pthfCell Start, pthfCell Goal);
+
+	//changes a cell of the grid and invalidates the affected paths
+	void pthfSetCost(pthfCell Cell, int Cost);
+	//for when the grid was modified directly
+	void pthfInvalidate(pthfCell Cell);
+	void pthfClear();
+
+	std::size_t pthfSize() const { return mPaths.size(); }
+
+private:
+	struct pthfEntry {
+		bool Found;
+		std::vector<pthfCell> Path;
+		//every region the path crosses (each once), so a dropped path can be removed from all of their lists
+		std::vector<int> Regions;
+	};
+
+	std::uint64_t pthfKey(pthfCell Start, pthfCell Goal) const;
+	int pthfRegion(pthfCell Cell) const;
+	//erases the path and removes its key from the lists of every region it crosses, except Skip
+	void pthfDrop(std::uint64_t Key, int Skip);
+
+	grdGrid2D<int>& mCosts;
+	int mRegionSize;
+	int mRegionCols;
+	std::unordered_map<std::uint64_t, pthfEntry> mPaths;
+	std::vector<std::vector<std::uint64_t>> mRegionPaths;
+	std::vector<std::uint64_t> mNotFound;
+};
@@ -0,0 +1,113 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//slot map
+//objects are stored densely (contiguous, like std::vector), but are referred to by keys that stay valid while other objects are added/removed
+//erase moves the last object into the gap (swap-and-pop), so both insert and erase are O(1)
+//iteration order is therefore not stable - only keys are
+struct sltmKey {
+	std::uint32_t Index;
+	std::uint32_t Generation;
+
+	friend bool operator==(sltmKey A, sltmKey B) { return A.Index == B.Index && A.Generation == B.Generation; }
+	friend bool operator!=(sltmKey A, sltmKey B) { return !(A == B); }
+};
+
+template <typename T>
+class sltmSlotMap {
+public:
+	using iterator = typename std::vector<T>::iterator;
+	using const_iterator = typename std::vector<T>::const_iterator;
+
+	template <typename... Args>
+	sltmKey sltmEmplace(Args&&... Arguments) {
+		std::uint32_t SlotIndex;
+		if (mFreeHead != sltmNone) {
+			SlotIndex = mFreeHead;
+			mFreeHead = mSlots[SlotIndex].DenseIndex;
+		}
+		else {
+			SlotIndex = static_cast<std::uint32_t>(mSlots.size());
+			mSlots.push_back({ 0, 0 });
+		}
+		mDense.emplace_back(std::forward<Args>(Arguments)...);
+		mDenseToSlot.push_back(SlotIndex);
+		mSlots[SlotIndex].DenseIndex = static_cast<std::uint32_t>(mDense.size() - 1);
+		return { SlotIndex, mSlots[SlotIndex].Generation };
+	}
+
+	sltmKey sltmInsert(T Value) { return sltmEmplace(std::move(Value)); }
+
+	//returns false if the key was already erased (or never belonged to this map)
+	bool sltmErase(sltmKey Key) {
+		if (!sltmContains(Key)) return false;
+
+		std::uint32_t Gap{ mSlots[Key.Index].DenseIndex };
+		std::uint32_t Last{ static_cast<std::uint32_t>(mDense.size() - 1) };
+		if (Gap != Last) {
+			mDense[Gap] = std::move(mDense[Last]);
+			mDenseToSlot[Gap] = mDenseToSlot[Last];
+			mSlots[mDenseToSlot[Gap]].DenseIndex = Gap;
+		}
+		mDense.pop_back();
+		mDenseToSlot.pop_back();
+
+		//bumping the generation invalidates every copy of the erased key
+		++mSlots[Key.Index].Generation;
+		mSlots[Key.Index].DenseIndex = mFreeHead;
+		mFreeHead = Key.Index;
+		return true;
+	}
+
+	bool sltmContains(sltmKey Key) const {
+		return Key.Index < mSlots.size()
+			&& mSlots[Key.Index].Generation == Key.Generation
+			&& mSlots[Key.Index].DenseIndex < mDense.size()
+			&& mDenseToSlot[mSlots[Key.Index].DenseIndex] == Key.Index;
+	}
+
+	//nullptr if the key is no longer valid
+	T* sltmFind(sltmKey Key) {
+		return sltmContains(Key) ? &mDense[mSlots[Key.Index].DenseIndex] : nullptr;
+	}
+	const T* sltmFind(sltmKey Key) const {
+		return sltmContains(Key) ? &mDense[mSlots[Key.Index].DenseIndex] : nullptr;
+	}
+
+	//key of the object at a given position of the dense storage (eg. while iterating)
+	sltmKey sltmKeyAt(std::size_t DenseIndex) const {
+		std::uint32_t SlotIndex{ mDenseToSlot[DenseIndex] };
+		return { SlotIndex, mSlots[SlotIndex].Generation };
+	}
+
+	void sltmReserve(std::size_t Capacity) {
+		mDense.reserve(Capacity);
+		mDenseToSlot.reserve(Capacity);
+		mSlots.reserve(Capacity);
+	}
+
+	std::size_t sltmSize() const { return mDense.size(); }
+	bool sltmIsEmpty() const { return mDense.empty(); }
+
+	//dense iteration - range-based for loops work directly on the map
+	iterator begin() { return mDense.begin(); }
+	iterator end() { return mDense.end(); }
+	const_iterator begin() const { return mDense.begin(); }
+	const_iterator end() const { return mDense.end(); }
+
+private:
+	static constexpr std::uint32_t sltmNone{ 0xFFFFFFFF };
+
+	//while a slot is free, DenseIndex links to the next free slot instead
+	struct sltmSlot {
+		std::uint32_t DenseIndex;
+		std::uint32_t Generation;
+	};
+
+	std::vector<T> mDense;
+	std::vector<std::uint32_t> mDenseToSlot;
+	std::vector<sltmSlot> mSlots;
+	std::uint32_t mFreeHead{ sltmNone };
+};
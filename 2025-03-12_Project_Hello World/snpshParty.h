@@ -0,0 +1,49 @@
+#pragma once
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+//flat, pointer-free copy of a party (snapshot)
+//w/out pointers or custom copy functions it is trivially copyable - taking or restoring one is a single memcpy
+//used for rollback and AI lookahead, where whole parties get copied thousands of times per second
+constexpr int snpshMaxPlayers{ 8 };
+
+struct snpshPlayer {
+	int Health;
+	int Level;
+	int Experience;
+};
+
+struct snpshParty {
+	int Count;
+	snpshPlayer Players[snpshMaxPlayers];
+};
+static_assert(std::is_trivially_copyable_v<snpshParty>, "snpshParty must stay memcpy-able");
+
+inline void snpshCopy(snpshParty& Destination, const snpshParty& Source) {
+	std::memcpy(&Destination, &Source, sizeof(snpshParty));
+}
+
+//fixed-size ring of the most recent snapshots (oldest one gets overwritten when full)
+template <int Capacity>
+class snpshHistory {
+public:
+	void snpshPush(const snpshParty& Party) {
+		snpshCopy(mFrames[mHead], Party);
+		mHead = (mHead + 1) % Capacity;
+		if (mSize < Capacity) ++mSize;
+	}
+
+	//0 - most recent snapshot, 1 - the one before it, etc. (only the snpshSize() most recent ones are stored)
+	const snpshParty& snpshGet(int FramesAgo) const {
+		assert(FramesAgo >= 0 && FramesAgo < mSize && "no snapshot that far back");
+		return mFrames[(mHead - 1 - FramesAgo + Capacity * 2) % Capacity];
+	}
+
+	int snpshSize() const { return mSize; }
+
+private:
+	snpshParty mFrames[Capacity];
+	int mHead{ 0 };
+	int mSize{ 0 };
+};
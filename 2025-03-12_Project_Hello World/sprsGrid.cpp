@@ -0,0 +1,172 @@
+#include "sprsGrid.h"
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+	constexpr std::size_t sprsChunkBytes{ sprsGrid::sprsChunkCells * sizeof(int) };
+}
+
+sprsGrid::sprsGrid(std::size_t ResidentBudget, const std::string& BackingPath, std::size_t MaxBackedChunks)
+	: mResidentBudget{ ResidentBudget < 1 ? 1 : ResidentBudget },
+	mBackingPath{ BackingPath },
+	mMaxBackedChunks{ MaxBackedChunks } {
+	const std::size_t Bytes{ mMaxBackedChunks * sprsChunkBytes };
+	if (Bytes == 0) return;
+
+	//if the file can't be created or mapped, the grid still works - it just never evicts
+#ifdef _WIN32
+	HANDLE File{ CreateFileA(mBackingPath.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+		CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr) };
+	if (File == INVALID_HANDLE_VALUE) return;
+	HANDLE Mapping{ CreateFileMappingA(File, nullptr, PAGE_READWRITE,
+		static_cast<DWORD>(static_cast<std::uint64_t>(Bytes) >> 32), static_cast<DWORD>(Bytes), nullptr) };
+	if (!Mapping) {
+		CloseHandle(File);
+		return;
+	}
+	mBackingBase = MapViewOfFile(Mapping, FILE_MAP_ALL_ACCESS, 0, 0, Bytes);
+	if (!mBackingBase) {
+		CloseHandle(Mapping);
+		CloseHandle(File);
+		return;
+	}
+	mFileHandle = File;
+	mMappingHandle = Mapping;
+#else
+	int File{ open(mBackingPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600) };
+	if (File < 0) return;
+	if (ftruncate(File, static_cast<off_t>(Bytes)) != 0) {
+		close(File);
+		return;
+	}
+	void* Base{ mmap(nullptr, Bytes, PROT_READ | PROT_WRITE, MAP_SHARED, File, 0) };
+	if (Base == MAP_FAILED) {
+		close(File);
+		return;
+	}
+	mBackingBase = Base;
+	mFileDescriptor = File;
+#endif
+
+	mFreeSlots.reserve(mMaxBackedChunks);
+	for (std::size_t Slot{ mMaxBackedChunks }; Slot > 0; --Slot) {
+		mFreeSlots.push_back(static_cast<std::int64_t>(Slot - 1));
+	}
+}
+
+sprsGrid::~sprsGrid() {
+	if (!mBackingBase) return;
+#ifdef _WIN32
+	UnmapViewOfFile(mBackingBase);
+	CloseHandle(mMappingHandle);
+	CloseHandle(mFileHandle);
+#else
+	munmap(mBackingBase, mMaxBackedChunks * sprsChunkBytes);
+	close(mFileDescriptor);
+	std::remove(mBackingPath.c_str());
+#endif
+}
+
+int sprsGrid::sprsGet(std::int32_t X, std::int32_t Y) {
+	const int* Cells{ sprsCells(X, Y, false) };
+	return Cells ? Cells[sprsLocalIndex(X, Y)] : 0;
+}
+
+void sprsGrid::sprsSet(std::int32_t X, std::int32_t Y, int Value) {
+	sprsCells(X, Y, true)[sprsLocalIndex(X, Y)] = Value;
+}
+
+void sprsGrid::sprsGetNeighbourhood(std::int32_t X, std::int32_t Y, int (&Out)[3][3]) {
+	const int LocalX{ X & (sprsChunkSize - 1) };
+	const int LocalY{ Y & (sprsChunkSize - 1) };
+	if (LocalX > 0 && LocalX < sprsChunkSize - 1 && LocalY > 0 && LocalY < sprsChunkSize - 1) {
+		const int* Cells{ sprsCells(X, Y, false) };
+		for (int dy{ -1 }; dy <= 1; ++dy) {
+			for (int dx{ -1 }; dx <= 1; ++dx) {
+				Out[dy + 1][dx + 1] = Cells ? Cells[((LocalY + dy) << sprsChunkShift) | (LocalX + dx)] : 0;
+			}
+		}
+		return;
+	}
+	//on a chunk border - up to 4 chunks are involved
+	for (int dy{ -1 }; dy <= 1; ++dy) {
+		for (int dx{ -1 }; dx <= 1; ++dx) {
+			Out[dy + 1][dx + 1] = sprsGet(X + dx, Y + dy);
+		}
+	}
+}
+
+int* sprsGrid::sprsCells(std::int32_t X, std::int32_t Y, bool Create) {
+	const std::uint64_t Key{ sprsKey(X >> sprsChunkShift, Y >> sprsChunkShift) };
+	if (mLastChunk && Key == mLastKey) {
+		mLastChunk->Referenced = true;
+		return mLastChunk->Cells.get();
+	}
+
+	auto Found{ mChunks.find(Key) };
+	if (Found == mChunks.end()) {
+		if (!Create) return nullptr;
+		Found = mChunks.emplace(Key, sprsChunk{}).first;
+	}
+	sprsChunk& Chunk{ Found->second };
+	if (!Chunk.Cells) {
+		sprsMakeResident(Key, Chunk);
+	}
+	Chunk.Referenced = true;
+
+	mLastKey = Key;
+	mLastChunk = &Chunk;
+	return Chunk.Cells.get();
+}
+
+void sprsGrid::sprsMakeResident(std::uint64_t Key, sprsChunk& Chunk) {
+	while (mResident.size() >= mResidentBudget && !mFreeSlots.empty()) {
+		sprsEvictOne();
+	}
+
+	Chunk.Cells = std::make_unique<int[]>(sprsChunkCells);
+	if (Chunk.BackingSlot >= 0) {
+		//paging back in - the slot in the file is released again
+		const char* Source{ static_cast<const char*>(mBackingBase) + Chunk.BackingSlot * sprsChunkBytes };
+		std::memcpy(Chunk.Cells.get(), Source, sprsChunkBytes);
+		mFreeSlots.push_back(Chunk.BackingSlot);
+		Chunk.BackingSlot = -1;
+	}
+	mResident.emplace_back(Key, &Chunk);
+}
+
+void sprsGrid::sprsEvictOne() {
+	//clock - chunks used since the hand last passed get a second chance
+	while (true) {
+		if (mClockHand >= mResident.size()) mClockHand = 0;
+		sprsChunk* Chunk{ mResident[mClockHand].second };
+		if (Chunk->Referenced) {
+			Chunk->Referenced = false;
+			++mClockHand;
+			continue;
+		}
+
+		Chunk->BackingSlot = mFreeSlots.back();
+		mFreeSlots.pop_back();
+		char* Destination{ static_cast<char*>(mBackingBase) + Chunk->BackingSlot * sprsChunkBytes };
+		std::memcpy(Destination, Chunk->Cells.get(), sprsChunkBytes);
+		Chunk->Cells.reset();
+
+		if (Chunk == mLastChunk) {
+			mLastChunk = nullptr;
+		}
+		mResident[mClockHand] = mResident.back();
+		mResident.pop_back();
+		return;
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//sparse chunked grid for huge maps (eg. 1M x 1M cells, mostly empty)
+// - cells are grouped into fixed 64x64 chunks, stored in a hash directory keyed by chunk coordinates
+// - a chunk is created only when one of its cells is first written, cells of missing chunks read as 0
+// - only ResidentBudget chunks are kept in memory, colder ones are evicted to a memory-mapped backing file
+//and paged back in the next time they're accessed (chosen w the "clock" approximation of least-recently-used)
+//if the backing file is full, chunks simply stay resident (the budget is exceeded rather than losing data)
+class sprsGrid {
+public:
+	static constexpr int sprsChunkShift{ 6 };
+	static constexpr int sprsChunkSize{ 1 << sprsChunkShift };
+	static constexpr int sprsChunkCells{ sprsChunkSize * sprsChunkSize };
+
+	sprsGrid(std::size_t ResidentBudget, const std::string& BackingPath, std::size_t MaxBackedChunks);
+	~sprsGrid();
+	sprsGrid(const sprsGrid&) = delete;
+	sprsGrid& operator=(const sprsGrid&) = delete;
+
+	int sprsGet(std::int32_t X, std::int32_t Y);
+	void sprsSet(std::int32_t X, std::int32_t Y, int Value);
+
+	//3x3 neighbourhood centered on (X, Y), Out[dy + 1][dx + 1]
+	//when the whole neighbourhood is inside one chunk (most cells) it is read w a single chunk lookup
+	void sprsGetNeighbourhood(std::int32_t X, std::int32_t Y, int (&Out)[3][3]);
+
+	std::size_t sprsChunkCount() const { return mChunks.size(); }
+	std::size_t sprsResidentCount() const { return mResident.size(); }
+	bool sprsHasBacking() const { return mBackingBase != nullptr; }
+
+private:
+	struct sprsChunk {
+		std::unique_ptr<int[]> Cells; //nullptr while evicted
+		std::int64_t BackingSlot{ -1 };
+		bool Referenced{ false };
+	};
+
+	static std::uint64_t sprsKey(std::int32_t ChunkX, std::int32_t ChunkY) {
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(ChunkX)) << 32) | static_cast<std::uint32_t>(ChunkY);
+	}
+	static int sprsLocalIndex(std::int32_t X, std::int32_t Y) {
+		return ((Y & (sprsChunkSize - 1)) << sprsChunkShift) | (X & (sprsChunkSize - 1));
+	}
+
+	//returns the cells of a chunk, paging it in if needed (nullptr if the chunk doesn't exist and Create is false)
+	int* sprsCells(std::int32_t X, std::int32_t Y, bool Create);
+	void sprsMakeResident(std::uint64_t Key, sprsChunk& Chunk);
+	void sprsEvictOne();
+
+	std::unordered_map<std::uint64_t, sprsChunk> mChunks;
+
+	//clock over resident chunks
+	std::vector<std::pair<std::uint64_t, sprsChunk*>> mResident;
+	std::size_t mClockHand{ 0 };
+	std::size_t mResidentBudget;
+
+	//single-entry cache of the most recently used chunk
+	std::uint64_t mLastKey{ 0 };
+	sprsChunk* mLastChunk{ nullptr };
+
+	//backing file
+	std::string mBackingPath;
+	std::size_t mMaxBackedChunks;
+	void* mBackingBase{ nullptr };
+	std::vector<std::int64_t> mFreeSlots;
+#ifdef _WIN32
+	void* mFileHandle{ nullptr };
+	void* mMappingHandle{ nullptr };
+#else
+	int mFileDescriptor{ -1 };
+#endif
+};
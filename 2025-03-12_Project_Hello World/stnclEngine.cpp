@@ -0,0 +1,97 @@
+#include "stnclEngine.h"
+#include <algorithm>
+#include <cassert>
+#include "wstpThreadPool.h"
+
+namespace {
+	//one pool for every pass, created on first use - so a pass no longer starts and joins a thread per band
+	wstpPool& stnclGetPool() {
+		static wstpPool Pool;
+		return Pool;
+	}
+}
+
+void stnclParallelRows(int Rows, int Cols, int Bands, const std::function<void(int FirstRow, int EndRow)>& Band) {
+	wstpPool& Pool{ stnclGetPool() };
+	if (Bands <= 0) {
+		Bands = Pool.wstpWorkerCount() + 1;
+	}
+	const long long Cells{ static_cast<long long>(Rows) * Cols };
+	Bands = std::min({ Bands, Rows / stnclMinRowsPerBand, static_cast<int>(std::min<long long>(Cells / stnclMinCellsPerBand, Rows)) });
+	if (Bands <= 1) {
+		if (Rows > 0) Band(0, Rows);
+		return;
+	}
+
+	wstpTaskGroup Group{ Pool };
+	for (int i{ 1 }; i < Bands; ++i) {
+		Group.wstpRun([&Band, FirstRow{ Rows * i / Bands }, EndRow{ Rows * (i + 1) / Bands }] { Band(FirstRow, EndRow); });
+	}
+	//calling thread handles the first band itself
+	Band(0, Rows / Bands);
+	Group.wstpWait();
+}
+
+void stnclPrepareDestination(const grdGrid2D<int>& Source, grdGrid2D<int>& Destination) {
+	assert(&Source != &Destination && "stencils can't run in place");
+	if (Destination.grdRows() != Source.grdRows() || Destination.grdCols() != Source.grdCols()) {
+		Destination = grdGrid2D<int>{ Source.grdRows(), Source.grdCols() };
+	}
+}
+
+namespace {
+	constexpr stnclKernel3 stnclDiffusionKernel{ {
+		{ 0, 1, 0 },
+		{ 1, 4, 1 },
+		{ 0, 1, 0 }
+	}, 3 };
+}
+
+void stnclDiffuse(const grdGrid2D<int>& Source, grdGrid2D<int>& Destination, int Decay, int Bands) {
+	stnclPrepareDestination(Source, Destination);
+	const int Cols{ Source.grdCols() };
+	stnclParallelRows(Source.grdRows(), Cols, Bands, [&](int FirstRow, int EndRow) {
+		std::vector<int> Accumulator(Cols);
+		for (int Row{ FirstRow }; Row < EndRow; ++Row) {
+			std::fill(Accumulator.begin(), Accumulator.end(), 0);
+			stnclAccumulateRow(Source, Row, stnclDiffusionKernel, Accumulator.data());
+			int* Out{ Destination.grdRowData(Row) };
+			for (int Col{ 0 }; Col < Cols; ++Col) {
+				Out[Col] = ((Accumulator[Col] >> stnclDiffusionKernel.Shift) * Decay) >> 8;
+			}
+		}
+	});
+}
+
+void stnclDiffuseSteps(grdGrid2D<int>& Grid, int Steps, int Decay, int Bands) {
+	grdGrid2D<int> Scratch{ Grid.grdRows(), Grid.grdCols() };
+	for (int Step{ 0 }; Step < Steps; ++Step) {
+		stnclDiffuse(Grid, Scratch, Decay, Bands);
+		std::swap(Grid, Scratch);
+	}
+}
+
+void stnclPropagateMax(const grdGrid2D<int>& Source, grdGrid2D<int>& Destination, int Falloff, int Bands) {
+	stnclPrepareDestination(Source, Destination);
+	const int Rows{ Source.grdRows() };
+	const int Cols{ Source.grdCols() };
+	stnclParallelRows(Rows, Cols, Bands, [&](int FirstRow, int EndRow) {
+		for (int Row{ FirstRow }; Row < EndRow; ++Row) {
+			int* Out{ Destination.grdRowData(Row) };
+			const int* Center{ Source.grdRowData(Row) };
+			std::copy(Center, Center + Cols, Out);
+			for (int dy{ -1 }; dy <= 1; ++dy) {
+				if (Row + dy < 0 || Row + dy >= Rows) continue;
+				const int* In{ Source.grdRowData(Row + dy) };
+				for (int dx{ -1 }; dx <= 1; ++dx) {
+					if (dy == 0 && dx == 0) continue;
+					const int First{ dx < 0 ? 1 : 0 };
+					const int End{ dx > 0 ? Cols - 1 : Cols };
+					for (int Col{ First }; Col < End; ++Col) {
+						Out[Col] = std::max(Out[Col], In[Col + dx] - Falloff);
+					}
+				}
+			}
+		}
+	});
+}
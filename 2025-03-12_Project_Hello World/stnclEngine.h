@@ -0,0 +1,83 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include "grdGrid2D.h"
+
+//stencil operators for influence/threat maps
+//every output cell is computed from a small neighbourhood of input cells, so:
+// - within a row, each kernel tap is applied to the whole row in one simple loop (which the compiler can vectorize)
+// - rows are split into bands that run as tasks on a thread pool shared by every pass (see wstpThreadPool.h)
+//Source and Destination must be different grids - bands read their halo rows (rows just outside the band) directly from Source,
+//which nobody writes to during the pass, so no extra synchronization is needed between bands
+//Destination is resized to Source's dimensions first if they differ
+//cells outside the grid are treated as 0
+
+//handing a band to a pool worker (waking it up, its cache filling w the rows) still costs a few microseconds,
+//so every band gets at least this much work (grids below stnclMinCellsPerBand * 2 cells simply run on the calling thread)
+constexpr int stnclMinRowsPerBand{ 4 };
+constexpr int stnclMinCellsPerBand{ 8 * 1024 };
+
+//Bands - most threads to use, 0 uses every thread of the pool (fewer are used if the grid is too small to be worth it)
+//the calling thread runs the first band itself, and helps w the others while it waits
+void stnclParallelRows(int Rows, int Cols, int Bands, const std::function<void(int FirstRow, int EndRow)>& Band);
+
+//asserts the grids are different, and makes Destination the same size as Source
+void stnclPrepareDestination(const grdGrid2D<int>& Source, grdGrid2D<int>& Destination);
+
+//(2 * Radius + 1)^2 weights, output = weighted sum >> Shift
+template <int Radius>
+struct stnclKernel {
+	int Weights[2 * Radius + 1][2 * Radius + 1];
+	int Shift;
+};
+using stnclKernel3 = stnclKernel<1>;
+using stnclKernel5 = stnclKernel<2>;
+
+//accumulates one output row of a convolution into Accumulator (which must hold grdCols() zeros)
+template <int Radius>
+void stnclAccumulateRow(const grdGrid2D<int>& Source, int Row, const stnclKernel<Radius>& Kernel, int* Accumulator) {
+	const int Cols{ Source.grdCols() };
+	for (int dy{ -Radius }; dy <= Radius; ++dy) {
+		const int SourceRow{ Row + dy };
+		if (SourceRow < 0 || SourceRow >= Source.grdRows()) continue;
+		const int* In{ Source.grdRowData(SourceRow) };
+		for (int dx{ -Radius }; dx <= Radius; ++dx) {
+			const int Weight{ Kernel.Weights[dy + Radius][dx + Radius] };
+			if (Weight == 0) continue;
+			const int First{ dx < 0 ? -dx : 0 };
+			const int End{ dx > 0 ? Cols - dx : Cols };
+			for (int Col{ First }; Col < End; ++Col) {
+				Accumulator[Col] += Weight * In[Col + dx];
+			}
+		}
+	}
+}
+
+template <int Radius>
+void stnclConvolve(const grdGrid2D<int>& Source, grdGrid2D<int>& Destination, const stnclKernel<Radius>& Kernel, int Bands = 0) {
+	stnclPrepareDestination(Source, Destination);
+	const int Cols{ Source.grdCols() };
+	stnclParallelRows(Source.grdRows(), Cols, Bands, [&](int FirstRow, int EndRow) {
+		std::vector<int> Accumulator(Cols);
+		for (int Row{ FirstRow }; Row < EndRow; ++Row) {
+			std::fill(Accumulator.begin(), Accumulator.end(), 0);
+			stnclAccumulateRow(Source, Row, Kernel, Accumulator.data());
+			int* Out{ Destination.grdRowData(Row) };
+			for (int Col{ 0 }; Col < Cols; ++Col) {
+				Out[Col] = Accumulator[Col] >> Kernel.Shift;
+			}
+		}
+	});
+}
+
+//one diffusion step - each cell becomes a blend of itself and its 4 neighbours, then decays
+//Decay is out of 256 (256 - no decay, 128 - half)
+void stnclDiffuse(const grdGrid2D<int>& Source, grdGrid2D<int>& Destination, int Decay, int Bands = 0);
+
+//runs Steps diffusion steps in place (internally ping-pongs between Grid and a scratch grid)
+void stnclDiffuseSteps(grdGrid2D<int>& Grid, int Steps, int Decay, int Bands = 0);
+
+//each cell becomes the max of itself and its 8 neighbours minus Falloff
+//(spreads peaks outwards by one cell per pass, losing Falloff per cell - N cells away takes N passes)
+void stnclPropagateMax(const grdGrid2D<int>& Source, grdGrid2D<int>& Destination, int Falloff, int Bands = 0);
@@ -0,0 +1,211 @@
+#include "strtSaturate.h"
+#include <cassert>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define STRT_SSE2 1
+#else
+#define STRT_SSE2 0
+#endif
+
+namespace {
+	template <typename T>
+	T strtClamp(T Value, T Min, T Max) {
+		return Value < Min ? Min : Value > Max ? Max : Value;
+	}
+
+#if STRT_SSE2
+	__m128i strtLoad(const void* Address) { return _mm_loadu_si128(static_cast<const __m128i*>(Address)); }
+	void strtStore(void* Address, __m128i Value) { _mm_storeu_si128(static_cast<__m128i*>(Address), Value); }
+
+	//per lane: Mask ? A : B (Mask lanes are all 1s or all 0s)
+	__m128i strtSelect(__m128i Mask, __m128i A, __m128i B) {
+		return _mm_or_si128(_mm_and_si128(Mask, A), _mm_andnot_si128(Mask, B));
+	}
+
+	__m128i strtClamp16(__m128i Value, __m128i Min, __m128i Max) {
+		return _mm_min_epi16(_mm_max_epi16(Value, Min), Max);
+	}
+
+	//SSE2 has no 32-bit min/max (those came w SSE4.1), so compare and select
+	__m128i strtClamp32(__m128i Value, __m128i Min, __m128i Max) {
+		Value = strtSelect(_mm_cmpgt_epi32(Min, Value), Min, Value);
+		return strtSelect(_mm_cmpgt_epi32(Value, Max), Max, Value);
+	}
+
+	//limit in the direction A was heading: INT32_MIN for negative A, INT32_MAX otherwise
+	__m128i strtLimit32(__m128i A) {
+		return _mm_xor_si128(_mm_srai_epi32(A, 31), _mm_set1_epi32(INT32_MAX));
+	}
+
+	//adding two values of the same sign overflowed if the sign of the result is different
+	__m128i strtAdds32(__m128i A, __m128i B) {
+		const __m128i Sum{ _mm_add_epi32(A, B) };
+		const __m128i Overflow{ _mm_srai_epi32(_mm_andnot_si128(_mm_xor_si128(A, B), _mm_xor_si128(A, Sum)), 31) };
+		return strtSelect(Overflow, strtLimit32(A), Sum);
+	}
+
+	//subtracting a value of the opposite sign overflowed if the result's sign doesn't match A
+	__m128i strtSubs32(__m128i A, __m128i B) {
+		const __m128i Difference{ _mm_sub_epi32(A, B) };
+		const __m128i Overflow{ _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(A, B), _mm_xor_si128(A, Difference)), 31) };
+		return strtSelect(Overflow, strtLimit32(A), Difference);
+	}
+
+	//full 32-bit products from the low and high halves, then packed back to 16 bits w signed saturation
+	__m128i strtMuls16(__m128i A, __m128i B) {
+		const __m128i Low{ _mm_mullo_epi16(A, B) };
+		const __m128i High{ _mm_mulhi_epi16(A, B) };
+		return _mm_packs_epi32(_mm_unpacklo_epi16(Low, High), _mm_unpackhi_epi16(Low, High));
+	}
+#endif
+}
+
+void strtAddClamp(std::int16_t* Values, int Count, std::int16_t Amount, std::int16_t Min, std::int16_t Max) {
+	assert(Min <= Max);
+	int i{ 0 };
+#if STRT_SSE2
+	const __m128i VectorAmount{ _mm_set1_epi16(Amount) };
+	const __m128i VectorMin{ _mm_set1_epi16(Min) };
+	const __m128i VectorMax{ _mm_set1_epi16(Max) };
+	for (; i + 8 <= Count; i += 8) {
+		strtStore(Values + i, strtClamp16(_mm_adds_epi16(strtLoad(Values + i), VectorAmount), VectorMin, VectorMax));
+	}
+#endif
+	for (; i < Count; ++i) {
+		Values[i] = strtClamp(strtAdd(Values[i], Amount), Min, Max);
+	}
+}
+
+void strtSubClamp(std::int16_t* Values, int Count, std::int16_t Amount, std::int16_t Min, std::int16_t Max) {
+	assert(Min <= Max);
+	int i{ 0 };
+#if STRT_SSE2
+	const __m128i VectorAmount{ _mm_set1_epi16(Amount) };
+	const __m128i VectorMin{ _mm_set1_epi16(Min) };
+	const __m128i VectorMax{ _mm_set1_epi16(Max) };
+	for (; i + 8 <= Count; i += 8) {
+		strtStore(Values + i, strtClamp16(_mm_subs_epi16(strtLoad(Values + i), VectorAmount), VectorMin, VectorMax));
+	}
+#endif
+	for (; i < Count; ++i) {
+		Values[i] = strtClamp(strtSub(Values[i], Amount), Min, Max);
+	}
+}
+
+void strtMulClamp(std::int16_t* Values, int Count, std::int16_t Factor, std::int16_t Min, std::int16_t Max) {
+	assert(Min <= Max);
+	int i{ 0 };
+#if STRT_SSE2
+	const __m128i VectorFactor{ _mm_set1_epi16(Factor) };
+	const __m128i VectorMin{ _mm_set1_epi16(Min) };
+	const __m128i VectorMax{ _mm_set1_epi16(Max) };
+	for (; i + 8 <= Count; i += 8) {
+		strtStore(Values + i, strtClamp16(strtMuls16(strtLoad(Values + i), VectorFactor), VectorMin, VectorMax));
+	}
+#endif
+	for (; i < Count; ++i) {
+		Values[i] = strtClamp(strtMul(Values[i], Factor), Min, Max);
+	}
+}
+
+void strtAddClamp(std::int32_t* Values, int Count, std::int32_t Amount, std::int32_t Min, std::int32_t Max) {
+	assert(Min <= Max);
+	int i{ 0 };
+#if STRT_SSE2
+	const __m128i VectorAmount{ _mm_set1_epi32(Amount) };
+	const __m128i VectorMin{ _mm_set1_epi32(Min) };
+	const __m128i VectorMax{ _mm_set1_epi32(Max) };
+	for (; i + 4 <= Count; i += 4) {
+		strtStore(Values + i, strtClamp32(strtAdds32(strtLoad(Values + i), VectorAmount), VectorMin, VectorMax));
+	}
+#endif
+	for (; i < Count; ++i) {
+		Values[i] = strtClamp(strtAdd(Values[i], Amount), Min, Max);
+	}
+}
+
+void strtSubClamp(std::int32_t* Values, int Count, std::int32_t Amount, std::int32_t Min, std::int32_t Max) {
+	assert(Min <= Max);
+	int i{ 0 };
+#if STRT_SSE2
+	const __m128i VectorAmount{ _mm_set1_epi32(Amount) };
+	const __m128i VectorMin{ _mm_set1_epi32(Min) };
+	const __m128i VectorMax{ _mm_set1_epi32(Max) };
+	for (; i + 4 <= Count; i += 4) {
+		strtStore(Values + i, strtClamp32(strtSubs32(strtLoad(Values + i), VectorAmount), VectorMin, VectorMax));
+	}
+#endif
+	for (; i < Count; ++i) {
+		Values[i] = strtClamp(strtSub(Values[i], Amount), Min, Max);
+	}
+}
+
+//SSE2 can't multiply 32-bit lanes into 32-bit results, so this stays a 64-bit scalar loop (which compilers can still vectorize on newer targets)
+void strtMulClamp(std::int32_t* Values, int Count, std::int32_t Factor, std::int32_t Min, std::int32_t Max) {
+	assert(Min <= Max);
+	for (int i{ 0 }; i < Count; ++i) {
+		const std::int64_t Product{ static_cast<std::int64_t>(Values[i]) * Factor };
+		Values[i] = static_cast<std::int32_t>(strtClamp<std::int64_t>(Product, Min, Max));
+	}
+}
+
+void strtAddClamp(std::int16_t* Values, const std::int16_t* Amounts, int Count, std::int16_t Min, std::int16_t Max) {
+	assert(Min <= Max);
+	int i{ 0 };
+#if STRT_SSE2
+	const __m128i VectorMin{ _mm_set1_epi16(Min) };
+	const __m128i VectorMax{ _mm_set1_epi16(Max) };
+	for (; i + 8 <= Count; i += 8) {
+		strtStore(Values + i, strtClamp16(_mm_adds_epi16(strtLoad(Values + i), strtLoad(Amounts + i)), VectorMin, VectorMax));
+	}
+#endif
+	for (; i < Count; ++i) {
+		Values[i] = strtClamp(strtAdd(Values[i], Amounts[i]), Min, Max);
+	}
+}
+
+void strtSubClamp(std::int16_t* Values, const std::int16_t* Amounts, int Count, std::int16_t Min, std::int16_t Max) {
+	assert(Min <= Max);
+	int i{ 0 };
+#if STRT_SSE2
+	const __m128i VectorMin{ _mm_set1_epi16(Min) };
+	const __m128i VectorMax{ _mm_set1_epi16(Max) };
+	for (; i + 8 <= Count; i += 8) {
+		strtStore(Values + i, strtClamp16(_mm_subs_epi16(strtLoad(Values + i), strtLoad(Amounts + i)), VectorMin, VectorMax));
+	}
+#endif
+	for (; i < Count; ++i) {
+		Values[i] = strtClamp(strtSub(Values[i], Amounts[i]), Min, Max);
+	}
+}
+
+void strtAddClamp(std::int32_t* Values, const std::int32_t* Amounts, int Count, std::int32_t Min, std::int32_t Max) {
+	assert(Min <= Max);
+	int i{ 0 };
+#if STRT_SSE2
+	const __m128i VectorMin{ _mm_set1_epi32(Min) };
+	const __m128i VectorMax{ _mm_set1_epi32(Max) };
+	for (; i + 4 <= Count; i += 4) {
+		strtStore(Values + i, strtClamp32(strtAdds32(strtLoad(Values + i), strtLoad(Amounts + i)), VectorMin, VectorMax));
+	}
+#endif
+	for (; i < Count; ++i) {
+		Values[i] = strtClamp(strtAdd(Values[i], Amounts[i]), Min, Max);
+	}
+}
+
+void strtSubClamp(std::int32_t* Values, const std::int32_t* Amounts, int Count, std::int32_t Min, std::int32_t Max) {
+	assert(Min <= Max);
+	int i{ 0 };
+#if STRT_SSE2
+	const __m128i VectorMin{ _mm_set1_epi32(Min) };
+	const __m128i VectorMax{ _mm_set1_epi32(Max) };
+	for (; i + 4 <= Count; i += 4) {
+		strtStore(Values + i, strtClamp32(strtSubs32(strtLoad(Values + i), strtLoad(Amounts + i)), VectorMin, VectorMax));
+	}
+#endif
+	for (; i < Count; ++i) {
+		Values[i] = strtClamp(strtSub(Values[i], Amounts[i]), Min, Max);
+	}
+}
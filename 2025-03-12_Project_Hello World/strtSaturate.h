@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+
+//saturating arithmetic - instead of wrapping around on overflow (like int Number{ 2'000'000'000 } + 1'000'000'000 does)
+//results stick to the limit of the type, and are then clamped into [Min, Max] in the same pass
+//so a damage pass can't wrap health around, and doesn't need a separate "if (Health < 0) Health = 0" pass afterwards
+
+// - single values
+inline std::int16_t strtAdd(std::int16_t A, std::int16_t B) {
+	const int Result{ A + B };
+	return static_cast<std::int16_t>(Result > INT16_MAX ? INT16_MAX : Result < INT16_MIN ? INT16_MIN : Result);
+}
+inline std::int16_t strtSub(std::int16_t A, std::int16_t B) {
+	const int Result{ A - B };
+	return static_cast<std::int16_t>(Result > INT16_MAX ? INT16_MAX : Result < INT16_MIN ? INT16_MIN : Result);
+}
+inline std::int16_t strtMul(std::int16_t A, std::int16_t B) {
+	const int Result{ A * B };
+	return static_cast<std::int16_t>(Result > INT16_MAX ? INT16_MAX : Result < INT16_MIN ? INT16_MIN : Result);
+}
+inline std::int32_t strtAdd(std::int32_t A, std::int32_t B) {
+	const std::int64_t Result{ static_cast<std::int64_t>(A) + B };
+	return static_cast<std::int32_t>(Result > INT32_MAX ? INT32_MAX : Result < INT32_MIN ? INT32_MIN : Result);
+}
+inline std::int32_t strtSub(std::int32_t A, std::int32_t B) {
+	const std::int64_t Result{ static_cast<std::int64_t>(A) - B };
+	return static_cast<std::int32_t>(Result > INT32_MAX ? INT32_MAX : Result < INT32_MIN ? INT32_MIN : Result);
+}
+inline std::int32_t strtMul(std::int32_t A, std::int32_t B) {
+	const std::int64_t Result{ static_cast<std::int64_t>(A) * B };
+	return static_cast<std::int32_t>(Result > INT32_MAX ? INT32_MAX : Result < INT32_MIN ? INT32_MIN : Result);
+}
+
+// - columns
+//Values[i] = clamp(Values[i] op Amount, Min, Max), for Count values
+//use SSE2 when the target has it (always on x64), w a scalar loop for the rest
+//the int16 add/sub use the hardware saturating instructions, int32 has none, so overflow is detected from the sign bits instead
+
+//same amount for everyone (eg. area damage, passive healing)
+void strtAddClamp(std::int16_t* Values, int Count, std::int16_t Amount, std::int16_t Min, std::int16_t Max);
+void strtSubClamp(std::int16_t* Values, int Count, std::int16_t Amount, std::int16_t Min, std::int16_t Max);
+void strtMulClamp(std::int16_t* Values, int Count, std::int16_t Factor, std::int16_t Min, std::int16_t Max);
+void strtAddClamp(std::int32_t* Values, int Count, std::int32_t Amount, std::int32_t Min, std::int32_t Max);
+void strtSubClamp(std::int32_t* Values, int Count, std::int32_t Amount, std::int32_t Min, std::int32_t Max);
+void strtMulClamp(std::int32_t* Values, int Count, std::int32_t Factor, std::int32_t Min, std::int32_t Max);
+
+//amount per value (eg. damage each entity took this frame)
+void strtAddClamp(std::int16_t* Values, const std::int16_t* Amounts, int Count, std::int16_t Min, std::int16_t Max);
+void strtSubClamp(std::int16_t* Values, const std::int16_t* Amounts, int Count, std::int16_t Min, std::int16_t Max);
+void strtAddClamp(std::int32_t* Values, const std::int32_t* Amounts, int Count, std::int32_t Min, std::int32_t Max);
+void strtSubClamp(std::int32_t* Values, const std::int32_t* Amounts, int Count, std::int32_t Min, std::int32_t Max);
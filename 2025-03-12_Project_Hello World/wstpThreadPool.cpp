@@ -0,0 +1,243 @@
+#include "wstpThreadPool.h"
+#include <cassert>
+#include <functional>
+
+// - Chase-Lev deque
+//the owner pushes and takes at Bottom, thieves take from Top, only the last task needs a compare-exchange
+//(memory orders follow Le, Pop, Cohen, Zappa Nardelli - "Correct and Efficient Work-Stealing for Weak Memory Models")
+class wstpDeque {
+public:
+	wstpDeque() : mArray{ new wstpArray{ 256 } } {}
+	~wstpDeque() {
+		delete mArray.load(std::memory_order_relaxed);
+		for (wstpArray* Array : mRetired) delete Array;
+	}
+
+	//owner only
+	void wstpPush(wstpTask* Task) {
+		const std::int64_t Bottom{ mBottom.load(std::memory_order_relaxed) };
+		const std::int64_t Top{ mTop.load(std::memory_order_acquire) };
+		wstpArray* Array{ mArray.load(std::memory_order_relaxed) };
+		if (Bottom - Top > Array->Mask) Array = wstpGrow(Array, Top, Bottom);
+		Array->wstpPut(Bottom, Task);
+		mBottom.store(Bottom + 1, std::memory_order_release);
+	}
+
+	//owner only
+	wstpTask* wstpTake() {
+		const std::int64_t Bottom{ mBottom.load(std::memory_order_relaxed) - 1 };
+		wstpArray* Array{ mArray.load(std::memory_order_relaxed) };
+		mBottom.store(Bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::int64_t Top{ mTop.load(std::memory_order_relaxed) };
+		if (Top > Bottom) {
+			mBottom.store(Bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		wstpTask* Task{ Array->wstpGet(Bottom) };
+		if (Top == Bottom) {
+			//last task - racing the thieves for it
+			if (!mTop.compare_exchange_strong(Top, Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) Task = nullptr;
+			mBottom.store(Bottom + 1, std::memory_order_relaxed);
+		}
+		return Task;
+	}
+
+	//any thread, nullptr if empty or another thread won the race
+	wstpTask* wstpSteal() {
+		std::int64_t Top{ mTop.load(std::memory_order_acquire) };
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const std::int64_t Bottom{ mBottom.load(std::memory_order_acquire) };
+		if (Top >= Bottom) return nullptr;
+		wstpTask* Task{ mArray.load(std::memory_order_acquire)->wstpGet(Top) };
+		if (!mTop.compare_exchange_strong(Top, Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return nullptr;
+		return Task;
+	}
+
+	bool wstpEmpty() const {
+		return mTop.load(std::memory_order_relaxed) >= mBottom.load(std::memory_order_relaxed);
+	}
+
+private:
+	struct wstpArray {
+		explicit wstpArray(std::int64_t Capacity) : Mask{ Capacity - 1 }, Slots{ new std::atomic<wstpTask*>[Capacity] } {}
+		wstpTask* wstpGet(std::int64_t Index) const { return Slots[Index & Mask].load(std::memory_order_relaxed); }
+		void wstpPut(std::int64_t Index, wstpTask* Task) { Slots[Index & Mask].store(Task, std::memory_order_relaxed); }
+
+		std::int64_t Mask;
+		std::unique_ptr<std::atomic<wstpTask*>[]> Slots;
+	};
+
+	//thieves may still be reading the old array, so it's kept until the deque is destroyed
+	wstpArray* wstpGrow(wstpArray* Old, std::int64_t Top, std::int64_t Bottom) {
+		wstpArray* Array{ new wstpArray{ (Old->Mask + 1) * 2 } };
+		for (std::int64_t Index{ Top }; Index < Bottom; ++Index) Array->wstpPut(Index, Old->wstpGet(Index));
+		mRetired.push_back(Old);
+		mArray.store(Array, std::memory_order_release);
+		return Array;
+	}
+
+	//Top and Bottom on separate cache lines, thieves hammer Top while the owner works on Bottom
+	alignas(64) std::atomic<std::int64_t> mTop{ 0 };
+	alignas(64) std::atomic<std::int64_t> mBottom{ 0 };
+	std::atomic<wstpArray*> mArray;
+	std::vector<wstpArray*> mRetired;
+};
+
+class wstpWorker {
+public:
+	wstpWorker(wstpPool& Pool, int Index) : mPool{ Pool }, mIndex{ Index } {}
+
+	wstpPool& mPool;
+	int mIndex;
+	wstpDeque mDeque;
+};
+
+namespace {
+	//worker running on the calling thread (nullptr outside of any pool)
+	thread_local wstpWorker* wstpCurrent{ nullptr };
+
+	wstpWorker* wstpCurrentIn(const wstpPool* Pool) {
+		return wstpCurrent && &wstpCurrent->mPool == Pool ? wstpCurrent : nullptr;
+	}
+
+	//xorshift, so thieves start looking at different victims
+	std::uint32_t wstpRandom() {
+		thread_local std::uint32_t State{ static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1 };
+		State ^= State << 13;
+		State ^= State >> 17;
+		State ^= State << 5;
+		return State;
+	}
+}
+
+wstpPool::wstpPool(int Workers) {
+	assert(Workers >= 0);
+	for (int Index{ 0 }; Index < Workers; ++Index) mWorkers.push_back(std::make_unique<wstpWorker>(*this, Index));
+	//every worker exists before any thread starts stealing from them
+	for (int Index{ 0 }; Index < Workers; ++Index) mThreads.emplace_back([this, Index] { wstpWorkerLoop(*mWorkers[Index]); });
+}
+
+wstpPool::~wstpPool() {
+	{
+		std::lock_guard<std::mutex> Guard{ mParkLock };
+		mStopping = true;
+		mEpoch.fetch_add(1, std::memory_order_relaxed);
+	}
+	mPark.notify_all();
+	for (std::thread& Thread : mThreads) Thread.join();
+	assert(mShared.empty());
+}
+
+void wstpPool::wstpSubmit(wstpTask* Task) {
+	if (wstpWorker* Self{ wstpCurrentIn(this) }) {
+		Self->mDeque.wstpPush(Task);
+	}
+	else {
+		std::lock_guard<std::mutex> Guard{ mSharedLock };
+		mShared.push_back(Task);
+		mSharedCount.store(mShared.size(), std::memory_order_relaxed);
+	}
+	wstpWake();
+}
+
+//pairs w the fence in wstpWorkerLoop: either the sleeper sees the new task, or this sees the sleeper
+void wstpPool::wstpWake() {
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (mSleepers.load(std::memory_order_relaxed) == 0) return;
+	{
+		std::lock_guard<std::mutex> Guard{ mParkLock };
+		mEpoch.fetch_add(1, std::memory_order_relaxed);
+	}
+	mPark.notify_one();
+}
+
+wstpTask* wstpPool::wstpFind(wstpWorker* Self) {
+	if (Self) {
+		if (wstpTask* Task{ Self->mDeque.wstpTake() }) return Task;
+	}
+	if (mSharedCount.load(std::memory_order_relaxed) != 0) {
+		std::lock_guard<std::mutex> Guard{ mSharedLock };
+		if (!mShared.empty()) {
+			wstpTask* Task{ mShared.back() };
+			mShared.pop_back();
+			mSharedCount.store(mShared.size(), std::memory_order_relaxed);
+			return Task;
+		}
+	}
+	const int Count{ wstpWorkerCount() };
+	if (Count == 0) return nullptr;
+	const int First{ static_cast<int>(wstpRandom() % static_cast<std::uint32_t>(Count)) };
+	for (int Offset{ 0 }; Offset < Count; ++Offset) {
+		wstpWorker& Victim{ *mWorkers[(First + Offset) % Count] };
+		if (&Victim == Self) continue;
+		if (wstpTask* Task{ Victim.mDeque.wstpSteal() }) return Task;
+	}
+	return nullptr;
+}
+
+bool wstpPool::wstpRunOne() {
+	wstpTask* Task{ wstpFind(wstpCurrentIn(this)) };
+	if (!Task) return false;
+	Task->Run(Task);
+	return true;
+}
+
+bool wstpPool::wstpLocalEmpty() const {
+	if (const wstpWorker* Self{ wstpCurrentIn(this) }) return Self->mDeque.wstpEmpty();
+	return mSharedCount.load(std::memory_order_relaxed) == 0;
+}
+
+template <typename F>
+wstpTask* wstpPool::wstpPark(wstpWorker* Self, const F& Done) {
+	//announce going to sleep, then look once more - a task submitted in between is either found here,
+	//or its submitter sees mSleepers and changes the epoch, so the wait below returns right away
+	const std::uint64_t Epoch{ mEpoch.load(std::memory_order_relaxed) };
+	mSleepers.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (wstpTask* Task{ wstpFind(Self) }) {
+		mSleepers.fetch_sub(1, std::memory_order_relaxed);
+		return Task;
+	}
+	std::unique_lock<std::mutex> Lock{ mParkLock };
+	mPark.wait(Lock, [&] { return mStopping || mEpoch.load(std::memory_order_relaxed) != Epoch || Done(); });
+	mSleepers.fetch_sub(1, std::memory_order_relaxed);
+	return nullptr;
+}
+
+void wstpPool::wstpWorkerLoop(wstpWorker& Self) {
+	wstpCurrent = &Self;
+	while (true) {
+		wstpTask* Task{ wstpFind(&Self) };
+		if (!Task) Task = wstpPark(&Self, [] { return false; });
+		if (Task) {
+			Task->Run(Task);
+			continue;
+		}
+		std::lock_guard<std::mutex> Guard{ mParkLock };
+		if (mStopping) break;
+	}
+	wstpCurrent = nullptr;
+}
+
+void wstpPool::wstpWaitFor(const std::atomic<int>& Pending) {
+	wstpWorker* Self{ wstpCurrentIn(this) };
+	const auto Done{ [&Pending] { return Pending.load(std::memory_order_acquire) == 0; } };
+	while (!Done()) {
+		wstpTask* Task{ wstpFind(Self) };
+		if (!Task) Task = wstpPark(Self, Done);
+		if (Task) Task->Run(Task);
+	}
+}
+
+//taking the lock orders this after a waiter's check of its Pending (done under the lock in wstpPark), so the wake up can't be missed
+void wstpPool::wstpNotifyDone() {
+	{
+		std::lock_guard<std::mutex> Guard{ mParkLock };
+	}
+	mPark.notify_all();
+}
+
+void wstpTaskGroup::wstpWait() {
+	mPool.wstpWaitFor(mPending);
+}
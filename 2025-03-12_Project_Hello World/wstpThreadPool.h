@@ -0,0 +1,146 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//work-stealing job system, for spreading simulation work (battles, grid passes, ...) over every core
+// - every worker has its own deque of tasks (Chase-Lev): the owner pushes and pops at the bottom w/out locks,
+//   idle workers steal from the top of someone else's
+// - tasks started from outside the pool (eg. main()) go to a shared queue
+// - workers w nothing to do sleep on a condition variable (no spinning), and are woken when new tasks arrive
+// - a thread waiting for tasks to finish (wstpTaskGroup::wstpWait) runs other tasks meanwhile, and sleeps like a worker when there are none
+//
+//	wstpPool Pool;
+//	wstpParallelFor(Pool, 0, Count, [&](int i) { Health[i] -= Damage[i]; });
+//
+//	wstpTaskGroup Group{ Pool };
+//	Group.wstpRun([&] { UpdateGoblins(); });
+//	Group.wstpRun([&] { UpdateDragons(); });
+//	Group.wstpWait();
+
+class wstpTaskGroup;
+
+struct wstpTask {
+	void (*Run)(wstpTask* Task);
+	wstpTaskGroup* Group;
+};
+
+class wstpWorker;
+
+class wstpPool {
+public:
+	//Workers - number of worker threads (the thread waiting for results works too, so 0 runs everything on the caller)
+	explicit wstpPool(int Workers = static_cast<int>(std::max(1u, std::thread::hardware_concurrency())) - 1);
+	~wstpPool();
+	wstpPool(const wstpPool&) = delete;
+	wstpPool& operator=(const wstpPool&) = delete;
+
+	int wstpWorkerCount() const { return static_cast<int>(mWorkers.size()); }
+
+	//pushes to the calling worker's own deque, or to the shared queue when called from outside the pool
+	void wstpSubmit(wstpTask* Task);
+	//runs one task if any can be found, for threads waiting on a group
+	bool wstpRunOne();
+	//true if nothing is queued where the calling thread would push (then it's worth splitting work for others to steal)
+	bool wstpLocalEmpty() const;
+	//runs tasks until Pending reaches 0, sleeping while there's nothing to run (for wstpTaskGroup::wstpWait)
+	void wstpWaitFor(const std::atomic<int>& Pending);
+	//wakes the threads in wstpWaitFor, after a Pending they may wait on reached 0
+	void wstpNotifyDone();
+
+private:
+	friend class wstpWorker;
+
+	wstpTask* wstpFind(wstpWorker* Self);
+	void wstpWake();
+	void wstpWorkerLoop(wstpWorker& Self);
+	//the sleeping half of the worker loop - announces the sleep, looks for a task once more, then waits for a wake up
+	//(or for Done to become true) - returns a task found while going to sleep, if any
+	template <typename F>
+	wstpTask* wstpPark(wstpWorker* Self, const F& Done);
+
+	std::vector<std::unique_ptr<wstpWorker>> mWorkers;
+	std::mutex mSharedLock;
+	std::vector<wstpTask*> mShared;
+	std::atomic<std::size_t> mSharedCount{ 0 };
+
+	//parking: a sleeping worker waits until Epoch changes, submitters only take the lock when someone is asleep
+	std::mutex mParkLock;
+	std::condition_variable mPark;
+	std::atomic<std::uint64_t> mEpoch{ 0 };
+	std::atomic<int> mSleepers{ 0 };
+	bool mStopping{ false };
+	std::vector<std::thread> mThreads;
+};
+
+//fork/join: tasks started through a group are waited for together
+class wstpTaskGroup {
+public:
+	explicit wstpTaskGroup(wstpPool& Pool) : mPool{ Pool } {}
+	~wstpTaskGroup() { wstpWait(); }
+	wstpTaskGroup(const wstpTaskGroup&) = delete;
+	wstpTaskGroup& operator=(const wstpTaskGroup&) = delete;
+
+	template <typename F>
+	void wstpRun(F Function);
+	//returns once every task of the group finished, running tasks (from any group) while waiting
+	void wstpWait();
+
+	wstpPool& wstpGetPool() const { return mPool; }
+
+private:
+	template <typename F>
+	struct wstpFunctionTask : wstpTask {
+		F Function;
+	};
+
+	wstpPool& mPool;
+	std::atomic<int> mPending{ 0 };
+};
+
+template <typename F>
+void wstpTaskGroup::wstpRun(F Function) {
+	mPending.fetch_add(1, std::memory_order_relaxed);
+	auto* Task{ new wstpFunctionTask<F>{ { [](wstpTask* Base) {
+		auto* Self{ static_cast<wstpFunctionTask<F>*>(Base) };
+		wstpTaskGroup* Group{ Self->Group };
+		//the group may be gone as soon as mPending reaches 0 (its waiter returns), the pool outlives it
+		wstpPool& Pool{ Group->mPool };
+		Self->Function();
+		delete Self;
+		if (Group->mPending.fetch_sub(1, std::memory_order_acq_rel) == 1) Pool.wstpNotifyDone();
+	}, this }, std::move(Function) } };
+	mPool.wstpSubmit(Task);
+}
+
+// - parallel for
+//runs Body(i) for every i in [Begin, End)
+//chunking adapts to load: a range is worked through in small chunks, and its second half is only given away
+//(as a task others can steal) when the thread's own deque ran empty - so busy workers don't pay for splitting
+template <typename F>
+void wstpRunRange(wstpTaskGroup& Group, int Begin, int End, int Chunk, const F& Body) {
+	while (Begin < End) {
+		if (End - Begin > 2 * Chunk && Group.wstpGetPool().wstpLocalEmpty()) {
+			const int Middle{ Begin + (End - Begin) / 2 };
+			Group.wstpRun([&Group, Middle, End, Chunk, &Body] { wstpRunRange(Group, Middle, End, Chunk, Body); });
+			End = Middle;
+		}
+		const int ChunkEnd{ std::min(End, Begin + Chunk) };
+		for (; Begin < ChunkEnd; ++Begin) Body(Begin);
+	}
+}
+
+template <typename F>
+void wstpParallelFor(wstpPool& Pool, int Begin, int End, const F& Body) {
+	if (Begin >= End) return;
+	//small enough that every thread gets plenty of chunks to balance w
+	const int Chunk{ std::max(1, (End - Begin) / ((Pool.wstpWorkerCount() + 1) * 32)) };
+	wstpTaskGroup Group{ Pool };
+	wstpRunRange(Group, Begin, End, Chunk, Body);
+	Group.wstpWait();
+}